@@ -0,0 +1,82 @@
+// JavaScript bridge overheads, each next to a plain JavaScript baseline.
+//
+// Build the addon first (examples/scripting/js: npm install), then:
+//
+//   node benchmarks/js_bridge.js > js.json
+//
+// The output uses the layout of google-benchmark's JSON reports, so both can
+// be compared with the same tools.
+const os = require('os');
+const path = require('path');
+
+const intro = require(path.join(__dirname, '../examples/scripting/js/build/Release/introspection_demo'));
+
+class PlainPerson {
+    constructor(name, age, height) {
+        this.name = name;
+        this.age = age;
+        this.height = height;
+    }
+    celebrateBirthday() { this.age += 1; }
+}
+
+class PlainVehicle {
+    constructor() { this.mileage = 0; }
+    drive(miles) { this.mileage += miles; }
+}
+
+// Best of several repeats: the least disturbed run
+function nanosecondsPerCall(body, iterations) {
+    let best = Infinity;
+    for (let repeat = 0; repeat < 5; ++repeat) {
+        const start = process.hrtime.bigint();
+        for (let i = 0; i < iterations; ++i) {
+            body();
+        }
+        best = Math.min(best, Number(process.hrtime.bigint() - start) / iterations);
+    }
+    return best;
+}
+
+const person = new intro.Person('Alice', 30, 1.65);
+const vehicle = new intro.Vehicle('Honda', 'Civic', 2022);
+const plainPerson = new PlainPerson('Alice', 30, 1.65);
+const plainVehicle = new PlainVehicle();
+let sink = 0;
+
+// [name, body, baseline body]
+const cases = [
+    ['JS_MemberGet', () => { sink += person.age; }, () => { sink += plainPerson.age; }],
+    ['JS_MemberSet', () => { person.age = 30; }, () => { plainPerson.age = 30; }],
+    ['JS_MemberGet_ByName', () => { sink += person.getMemberValue('age'); }, () => { sink += plainPerson['age']; }],
+    ['JS_CallMethod/0', () => person.celebrateBirthday(), () => plainPerson.celebrateBirthday()],
+    ['JS_CallMethod/1', () => vehicle.drive(1.5), () => plainVehicle.drive(1.5)],
+    ['JS_CallMethod_ByName/0', () => person.callMethod('celebrateBirthday', []),
+        () => plainPerson['celebrateBirthday']()],
+    ['JS_Construct/3', () => new intro.Person('Alice', 30, 1.65), () => new PlainPerson('Alice', 30, 1.65)],
+];
+
+const iterations = Number(process.argv[2] || 200000);
+const benchmarks = [];
+for (const [name, body, baseline] of cases) {
+    for (const [suffix, code] of [['', body], ['_Baseline', baseline]]) {
+        const elapsed = nanosecondsPerCall(code, iterations);
+        const slash = name.indexOf('/');
+        benchmarks.push({
+            name: slash < 0 ? name + suffix : name.slice(0, slash) + suffix + name.slice(slash),
+            run_type: 'iteration',
+            iterations,
+            real_time: elapsed,
+            cpu_time: elapsed,
+            time_unit: 'ns',
+        });
+    }
+}
+
+console.log(JSON.stringify({
+    context: { executable: 'js_bridge.js', node: process.version, host_name: os.hostname() },
+    benchmarks,
+}, null, 2));
+if (sink === 0.5) {
+    console.error(sink); // Keeps the reads alive
+}
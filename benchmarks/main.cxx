@@ -0,0 +1,378 @@
+// main.cxx - Reflective vs direct access, serialization and registration costs
+//
+//   ./benchmarks --benchmark_out=results.json --benchmark_out_format=json
+//
+// Each reflective benchmark has a Direct counterpart doing the same work
+// through plain C++, so the results read as an overhead per call.
+#include <benchmark/benchmark.h>
+#include <introspection/binary.h>
+#include <introspection/introspectable.h>
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace introspection;
+
+class Particle : public Introspectable
+{
+    INTROSPECTABLE(Particle)
+
+public:
+    double x = 1.0;
+    double y = 2.0;
+    double z = 3.0;
+    int id = 7;
+    std::string label = "particle";
+
+    void reset() { x = y = z = 0.0; }
+    double scaled(double factor) const { return x * factor; }
+    void moveBy(double dx, double dy)
+    {
+        x += dx;
+        y += dy;
+    }
+    double weighted(double a, double b, double c) const { return a * x + b * y + c * z; }
+};
+
+void Particle::registerIntrospection(TypeRegistrar<Particle> reg)
+{
+    reg.member("x", &Particle::x)
+        .member("y", &Particle::y)
+        .member("z", &Particle::z)
+        .member("id", &Particle::id)
+        .member("label", &Particle::label)
+        .method("reset", &Particle::reset)
+        .method("scaled", &Particle::scaled)
+        .method("moveBy", &Particle::moveBy)
+        .method("weighted", &Particle::weighted);
+}
+
+// Member access -------------------------------------------------------
+
+static void MemberGet_ByName(benchmark::State &state)
+{
+    Particle particle;
+    const std::string name = "z";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.getMemberValue(name));
+    }
+}
+BENCHMARK(MemberGet_ByName);
+
+static void MemberGet_ByHandle(benchmark::State &state)
+{
+    Particle particle;
+    const auto z = particle.getMemberHandle("z");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.getMemberValue(z));
+    }
+}
+BENCHMARK(MemberGet_ByHandle);
+
+static void MemberGet_TypedRef(benchmark::State &state)
+{
+    Particle particle;
+    const auto z = particle.getMemberHandle("z");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.getMemberRef<double>(z));
+    }
+}
+BENCHMARK(MemberGet_TypedRef);
+
+static void MemberGet_Direct(benchmark::State &state)
+{
+    Particle particle;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.z);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(MemberGet_Direct);
+
+static void MemberSet_ByName(benchmark::State &state)
+{
+    Particle particle;
+    const std::string name = "z";
+    const Arg value = 4.0;
+    for (auto _ : state)
+    {
+        particle.setMemberValue(name, value);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(MemberSet_ByName);
+
+static void MemberSet_ByHandle(benchmark::State &state)
+{
+    Particle particle;
+    const auto z = particle.getMemberHandle("z");
+    const Arg value = 4.0;
+    for (auto _ : state)
+    {
+        particle.setMemberValue(z, value);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(MemberSet_ByHandle);
+
+static void MemberSet_Typed(benchmark::State &state)
+{
+    Particle particle;
+    const auto z = particle.getMemberHandle("z");
+    for (auto _ : state)
+    {
+        particle.setMember(z, 4.0);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(MemberSet_Typed);
+
+static void MemberSet_Direct(benchmark::State &state)
+{
+    Particle particle;
+    for (auto _ : state)
+    {
+        particle.z = 4.0;
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(MemberSet_Direct);
+
+// Method calls, by argument count (range(0)) ---------------------------
+
+namespace
+{
+    const char *const method_names[] = {"reset", "scaled", "moveBy", "weighted"};
+
+    // Boxed arguments for callMethod(), values for invoke()
+    struct CallArguments
+    {
+        std::array<double, 3> values{0.5, 0.25, 0.125};
+        Args boxed;
+        std::vector<ArgView> frame;
+
+        explicit CallArguments(std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                boxed.emplace_back(values[i]);
+                frame.push_back(ArgView::of(values[i]));
+            }
+        }
+    };
+}
+
+static void CallMethod_ByName(benchmark::State &state)
+{
+    Particle particle;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::string name = method_names[count];
+    CallArguments arguments(count);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.callMethod(name, arguments.boxed));
+    }
+}
+BENCHMARK(CallMethod_ByName)->DenseRange(0, 3);
+
+static void CallMethod_ByHandle(benchmark::State &state)
+{
+    Particle particle;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto method = particle.getMethodHandle(method_names[count]);
+    CallArguments arguments(count);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(particle.callMethod(method, arguments.boxed));
+    }
+}
+BENCHMARK(CallMethod_ByHandle)->DenseRange(0, 3);
+
+static void CallMethod_Invoke(benchmark::State &state)
+{
+    Particle particle;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto method = particle.getMethodHandle(method_names[count]);
+    CallArguments arguments(count);
+    double result = 0.0;
+    const ReturnSlot slot = count == 0 || count == 2 ? ReturnSlot{} : ReturnSlot::of(result);
+    for (auto _ : state)
+    {
+        particle.invoke(method, arguments.frame, slot);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(CallMethod_Invoke)->DenseRange(0, 3);
+
+static void CallMethod_Direct(benchmark::State &state)
+{
+    Particle particle;
+    const auto count = state.range(0);
+    const double a = 0.5, b = 0.25, c = 0.125;
+    for (auto _ : state)
+    {
+        switch (count)
+        {
+        case 0:
+            particle.reset();
+            break;
+        case 1:
+            benchmark::DoNotOptimize(particle.scaled(a));
+            break;
+        case 2:
+            particle.moveBy(a, b);
+            break;
+        default:
+            benchmark::DoNotOptimize(particle.weighted(a, b, c));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(CallMethod_Direct)->DenseRange(0, 3);
+
+// Serialization throughput, over range(0) objects ----------------------
+
+static void Serialize_Json(benchmark::State &state)
+{
+    std::vector<Particle> particles(static_cast<std::size_t>(state.range(0)));
+    std::string buffer;
+    for (auto _ : state)
+    {
+        buffer.clear();
+        JsonWriter json(buffer);
+        json.beginArray();
+        for (const auto &particle : particles)
+        {
+            particle.toJSON(json, JsonContent::ValuesOnly);
+        }
+        json.endArray();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(Serialize_Json)->Arg(1000);
+
+static void Serialize_JsonRead(benchmark::State &state)
+{
+    Particle source;
+    const std::string input = [&]
+    {
+        std::string buffer;
+        JsonWriter json(buffer);
+        source.toJSON(json, JsonContent::ValuesOnly);
+        return buffer;
+    }();
+    std::vector<Particle> particles(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        for (auto &particle : particles)
+        {
+            benchmark::DoNotOptimize(particle.fromJSON(input));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(input.size()));
+}
+BENCHMARK(Serialize_JsonRead)->Arg(1000);
+
+static void Serialize_BinaryWrite(benchmark::State &state)
+{
+    std::vector<Particle> particles(static_cast<std::size_t>(state.range(0)));
+    std::string buffer;
+    for (auto _ : state)
+    {
+        buffer.clear();
+        BinaryWriter writer(buffer);
+        for (const auto &particle : particles)
+        {
+            writer.write(particle);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(Serialize_BinaryWrite)->Arg(1000);
+
+static void Serialize_BinaryRead(benchmark::State &state)
+{
+    std::vector<Particle> particles(static_cast<std::size_t>(state.range(0)));
+    std::string buffer;
+    BinaryWriter writer(buffer);
+    for (const auto &particle : particles)
+    {
+        writer.write(particle);
+    }
+    for (auto _ : state)
+    {
+        BinaryReader reader(buffer);
+        for (auto &particle : particles)
+        {
+            reader.read(particle);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(Serialize_BinaryRead)->Arg(1000);
+
+// Registration: TypeInfo of N distinct classes built from scratch -------
+
+namespace
+{
+    template <int I>
+    struct Synthetic
+    {
+        int id = I;
+        double weight = 0.0;
+        std::string name;
+        std::vector<double> samples;
+
+        double score() const { return weight * id; }
+        void rename(const std::string &text) { name = text; }
+    };
+
+    template <int I>
+    TypeInfo describe()
+    {
+        TypeInfo info("Synthetic" + std::to_string(I));
+        TypeRegistrar<Synthetic<I>>(info)
+            .template constructor<>()
+            .member("id", &Synthetic<I>::id)
+            .member("weight", &Synthetic<I>::weight)
+            .member("name", &Synthetic<I>::name)
+            .member("samples", &Synthetic<I>::samples)
+            .method("score", &Synthetic<I>::score)
+            .method("rename", &Synthetic<I>::rename);
+        info.finalize();
+        return info;
+    }
+
+    template <int... I>
+    void describeAll(std::integer_sequence<int, I...>)
+    {
+        (benchmark::DoNotOptimize(describe<I>()), ...);
+    }
+}
+
+template <int N>
+static void Registration(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        describeAll(std::make_integer_sequence<int, N>{});
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE(Registration, 1);
+BENCHMARK_TEMPLATE(Registration, 16);
+BENCHMARK_TEMPLATE(Registration, 64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+"""Python bridge overheads, each next to a pure Python baseline.
+
+Build the module first (examples/scripting/python), then:
+
+    PYTHONPATH=examples/scripting/python/build python3 benchmarks/python_bridge.py > python.json
+
+The output uses the layout of google-benchmark's JSON reports, so both can
+be compared with the same tools.
+"""
+import json
+import platform
+import sys
+import timeit
+
+import pyintrospection as intro
+
+
+class PlainPerson:
+    def __init__(self, name, age, height):
+        self.name = name
+        self.age = age
+        self.height = height
+
+    def celebrate_birthday(self):
+        self.age += 1
+
+
+class PlainVehicle:
+    def __init__(self):
+        self.mileage = 0.0
+
+    def drive(self, miles):
+        self.mileage += miles
+
+
+def nanoseconds_per_call(statement, variables, number):
+    # Best of several repeats: the least disturbed run
+    timer = timeit.Timer(statement, globals=variables)
+    return min(timer.repeat(repeat=5, number=number)) / number * 1e9
+
+
+CASES = [
+    # name, statement, baseline statement
+    ("Python_MemberGet", "person.age", "plain_person.age"),
+    ("Python_MemberSet", "person.age = 30", "plain_person.age = 30"),
+    ("Python_MemberGet_ByName", "person.get_member_value('age')", "getattr(plain_person, 'age')"),
+    ("Python_CallMethod/0", "person.celebrate_birthday()", "plain_person.celebrate_birthday()"),
+    ("Python_CallMethod/1", "vehicle.drive(1.5)", "plain_vehicle.drive(1.5)"),
+    ("Python_CallMethod_ByName/0", "person.call_method('celebrateBirthday', [])",
+     "getattr(plain_person, 'celebrate_birthday')()"),
+    ("Python_Construct/3", "intro.Person('Alice', 30, 1.65)", "PlainPerson('Alice', 30, 1.65)"),
+]
+
+
+def main():
+    number = int(sys.argv[1]) if len(sys.argv) > 1 else 200000
+    variables = {
+        "intro": intro,
+        "PlainPerson": PlainPerson,
+        "person": intro.Person("Alice", 30, 1.65),
+        "vehicle": intro.Vehicle("Honda", "Civic", 2022),
+        "plain_person": PlainPerson("Alice", 30, 1.65),
+        "plain_vehicle": PlainVehicle(),
+    }
+    benchmarks = []
+    for name, statement, baseline in CASES:
+        for suffix, code in (("", statement), ("_Baseline", baseline)):
+            elapsed = nanoseconds_per_call(code, variables, number)
+            benchmarks.append({
+                "name": name.replace("/", suffix + "/", 1) if "/" in name else name + suffix,
+                "run_type": "iteration",
+                "iterations": number,
+                "real_time": elapsed,
+                "cpu_time": elapsed,
+                "time_unit": "ns",
+            })
+    report = {
+        "context": {
+            "executable": "python_bridge.py",
+            "python": platform.python_version(),
+            "host_name": platform.node(),
+        },
+        "benchmarks": benchmarks,
+    }
+    json.dump(report, sys.stdout, indent=2)
+    print()
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,12 @@
 #include <introspection/introspectable.h>
+#include <introspection/batch.h>
+#include <introspection/binary.h>
+#include <introspection/bulk.h>
+#include <introspection/mapped_archive.h>
+#include <introspection/patch.h>
+#include <introspection/soa.h>
+#include <array>
+#include <filesystem>
 #include <iostream>
 #include <cmath>
 #include <sstream>
@@ -32,9 +40,30 @@ public:
     }
 };
 
-// 1. Register the new type Vector3D
+// 1. Register the new type Vector3D, and how to serialize it (as [x,y,z])
 REGISTER_TYPE(Vector3D);
 
+template <>
+struct introspection::ValueTraits<Vector3D>
+{
+    using Components = std::array<float, 3>;
+
+    static void write(std::string &out, const Vector3D &v)
+    {
+        ValueTraits<Components>::write(out, Components{v.x, v.y, v.z});
+    }
+
+    static bool read(std::string_view json, Vector3D &v)
+    {
+        Components c;
+        if (!ValueTraits<Components>::read(json, c))
+            return false;
+        v = Vector3D(c[0], c[1], c[2]);
+        return true;
+    }
+};
+REGISTER_CODEC(Vector3D);
+
 // 2. Example class that uses Vector3D as a member
 class GameObject : public introspection::Introspectable
 {
@@ -87,15 +116,21 @@ public:
     {
         return name + " at " + position.toString() + " with " + std::to_string(health) + " health";
     }
+
+    static constexpr auto staticFields()
+    {
+        using introspection::field;
+        return introspection::describe(field("name", &GameObject::name),
+                                       field("position", &GameObject::position), // Vector3D member
+                                       field("velocity", &GameObject::velocity), // Vector3D member
+                                       field("health", &GameObject::health));
+    }
 };
 
 // 3. Registration implementation
 void GameObject::registerIntrospection(introspection::TypeRegistrar<GameObject> reg)
 {
-    reg.member("name", &GameObject::name)
-        .member("position", &GameObject::position) // Vector3D member
-        .member("velocity", &GameObject::velocity) // Vector3D member
-        .member("health", &GameObject::health)
+    reg.fields(staticFields())
         .method("getName", &GameObject::getName)
         .method("setName", &GameObject::setName)
         .method("getPosition", &GameObject::getPosition) // Returns Vector3D
@@ -115,6 +150,9 @@ int main()
 {
     GameObject player("Hero", Vector3D(10.0f, 5.0f, 0.0f));
 
+    // Registration is over: make type name and codec lookups lock-free
+    introspection::freezeRegistries();
+
     std::cout << "=== Vector3D Introspection Demo ===" << std::endl;
 
     // Print class info - will show Vector3D types
@@ -145,11 +183,141 @@ int main()
     player.callMethod("move", std::vector<std::any>{movement});
     player.callMethod("getInfo"); // Print updated info
 
+    // Vector3D members are serialized through their codec
+    std::cout << player.toJSON() << std::endl;
+
     // Call method with multiple parameters
     player.callMethod("teleport", std::vector<std::any>{0.0f, 0.0f, 10.0f});
 
     auto final_pos = std::any_cast<Vector3D>(player.callMethod("getPosition"));
     std::cout << "Final position: " << final_pos.toString() << std::endl;
 
+    // Binary snapshot: Vector3D and float members are copied raw
+    std::cout << std::endl << "=== Binary Snapshot ===" << std::endl;
+    std::string snapshot;
+    introspection::BinaryWriter writer(snapshot);
+    writer.write(player);
+    writer.write(GameObject("Npc", Vector3D(1.0f, 2.0f, 3.0f)));
+    std::cout << "Snapshot size: " << snapshot.size() << " bytes" << std::endl;
+
+    introspection::BinaryReader reader(snapshot);
+    GameObject restored, npc;
+    reader.read(restored);
+    reader.read(npc);
+    std::cout << "Restored: " << restored.getInfo() << std::endl;
+    std::cout << "Restored: " << npc.getInfo() << std::endl;
+
+    // Mapped archive: records are read in place from the mapped file
+    std::cout << std::endl << "=== Mapped Archive ===" << std::endl;
+    const auto archive_path = (std::filesystem::temp_directory_path() / "game_objects.imap").string();
+    introspection::MappedArchiveWriter archive_writer;
+    for (int i = 0; i < 1000; ++i)
+    {
+        GameObject object("Npc" + std::to_string(i), Vector3D(float(i), 0.0f, 0.0f));
+        object.setHealth(float(i % 100));
+        archive_writer.add(object);
+    }
+    archive_writer.save(archive_path);
+
+    {
+        introspection::MappedArchive archive(archive_path);
+        const auto &objects = archive.table(GameObject::getStaticTypeInfo());
+        auto name_member = objects.typeInfo()->findMember("name");
+        auto position_member = objects.typeInfo()->findMember("position");
+        auto health_member = objects.typeInfo()->findMember("health");
+        float total_health = 0.0f;
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            total_health += objects[i].getMemberRef<float>(health_member);
+        }
+        std::cout << "Archive: " << archive.fileSize() << " bytes, " << objects.size() << " "
+                  << objects.className() << " records" << std::endl;
+        std::cout << "Record 42: " << objects[42].getString(name_member) << " at "
+                  << objects[42].getMemberRef<Vector3D>(position_member).toString() << std::endl;
+        std::cout << "Total health: " << total_health << std::endl;
+    }
+    std::filesystem::remove(archive_path);
+
+    // Structure of arrays: a system tick only walks the column it updates
+    std::cout << std::endl << "=== SoA Container ===" << std::endl;
+    introspection::SoAVector<GameObject> population;
+    population.reserve(1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        population.emplace_back("Npc" + std::to_string(i), Vector3D(float(i), 0.0f, 0.0f));
+    }
+    for (float &health : population.column<float>("health"))
+    {
+        health -= 10.0f;
+    }
+    {
+        auto npc = population.proxy(7); // A GameObject, written back at the end of the scope
+        npc->callMethod("move", {Vector3D(0.0f, 1.0f, 0.0f)});
+    }
+    std::cout << "Row 7: " << population.get(7).getInfo() << std::endl;
+
+    // Bulk kernels: one member of many objects, without std::any
+    std::cout << std::endl << "=== Bulk Kernels ===" << std::endl;
+    auto health_column = population.column<float>("health");
+    introspection::bulk::scale(health_column, 0.5f);
+    std::cout << "Health: total " << introspection::bulk::sum(health_column) << ", min "
+              << introspection::bulk::min(health_column) << ", max " << introspection::bulk::max(health_column)
+              << std::endl;
+
+    std::vector<GameObject> squad(4, GameObject("Soldier", Vector3D()));
+    std::vector<float> squad_health(squad.size());
+    const auto health = GameObject::getStaticTypeInfo().findMember("health");
+    introspection::bulk::gather<float>(std::span<const GameObject>(squad), health, std::span<float>(squad_health));
+    introspection::bulk::axpy(-1.0f, std::vector<float>{5.0f, 10.0f, 15.0f, 20.0f}, squad_health);
+    introspection::bulk::scatter<float>(std::span<const float>(squad_health), std::span<GameObject>(squad), health);
+    std::cout << "Squad: " << squad[3].getInfo() << std::endl;
+
+    // Batch updates: several members, or many objects, checked once per call
+    std::cout << std::endl << "=== Batch Updates ===" << std::endl;
+    const auto &game_object_info = GameObject::getStaticTypeInfo();
+    const std::array<introspection::MemberHandle, 2> state{game_object_info.findMember("position"), health};
+    Vector3D spawn(1.0f, 2.0f, 3.0f);
+    float full_health = 100.0f;
+    const std::array<introspection::ArgView, 2> respawn{introspection::ArgView::of(spawn),
+                                                        introspection::ArgView::of(full_health)};
+    squad[0].setMembers(state, respawn);
+    std::cout << "Respawned: " << squad[0].getInfo() << std::endl;
+
+    introspection::ThreadPool pool;
+    std::vector<GameObject> crowd(100000);
+    std::vector<Vector3D> positions(crowd.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i] = Vector3D(float(i % 100), float(i / 100), 0.0f);
+    }
+    introspection::batch::setMember<Vector3D>(std::span<GameObject>(crowd), state[0],
+                                              std::span<const Vector3D>(positions), &pool);
+    std::cout << "Crowd of " << crowd.size() << " placed on " << pool.size() + 1 << " threads, last at "
+              << crowd.back().getPosition().toString() << std::endl;
+
+    std::vector<introspection::Introspectable *> squad_members;
+    for (auto &soldier : squad)
+    {
+        squad_members.push_back(&soldier);
+    }
+    const std::vector<introspection::Arg> squad_values(squad.size(), introspection::Arg(75.0f));
+    introspection::batch::setMembers(squad_members, std::span(state).subspan(1), squad_values);
+    std::cout << "Squad: " << squad[3].getInfo() << std::endl;
+
+    // Delta patches: replicate only the members that differ from the last state sent
+    std::cout << std::endl << "=== Delta Patches ===" << std::endl;
+    GameObject last_sent = player;
+    player.move(Vector3D(1.0f, 0.0f, 0.0f));
+    std::string delta;
+    const std::size_t changed = introspection::writePatch(delta, last_sent, player);
+    std::cout << changed << " member(s) changed: " << delta.size() << " bytes instead of "
+              << player.toJSON().size() << " for toJSON()" << std::endl;
+    GameObject replica = last_sent;
+    introspection::applyPatch(replica, delta);
+    std::string merge_patch;
+    introspection::JsonWriter json(merge_patch);
+    introspection::writeJsonPatch(json, last_sent, player);
+    std::cout << "Replica: " << replica.getInfo() << ", JSON form " << merge_patch << std::endl;
+
     return 0;
 }
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <sstream>
 #include <unordered_map>
 #include "../person.h"
 #include <httplib.h> // cpp-httplib library
@@ -48,27 +49,26 @@ std::string generateHtmlForm(const introspection::Introspectable &obj)
         html << "<div class='field'>\n";
         html << "<label for='" << name << "'>" << name << " (" << member->type_name << "):</label>\n";
 
-        auto value = member->getter(&obj);
+        const void *value = member->address(const_cast<introspection::Introspectable *>(&obj));
 
-        if (member->type_name == "string")
+        switch (member->type_id)
         {
+        case introspection::typeId<std::string>():
             html << "<input type='text' id='" << name << "' name='" << name
-                 << "' value='" << std::any_cast<std::string>(value) << "'>\n";
-        }
-        else if (member->type_name == "int")
-        {
+                 << "' value='" << *static_cast<const std::string *>(value) << "'>\n";
+            break;
+        case introspection::typeId<int>():
             html << "<input type='number' id='" << name << "' name='" << name
-                 << "' value='" << std::any_cast<int>(value) << "'>\n";
-        }
-        else if (member->type_name == "double")
-        {
+                 << "' value='" << *static_cast<const int *>(value) << "'>\n";
+            break;
+        case introspection::typeId<double>():
             html << "<input type='number' step='0.01' id='" << name << "' name='" << name
-                 << "' value='" << std::any_cast<double>(value) << "'>\n";
-        }
-        else if (member->type_name == "bool")
-        {
+                 << "' value='" << *static_cast<const double *>(value) << "'>\n";
+            break;
+        case introspection::typeId<bool>():
             html << "<input type='checkbox' id='" << name << "' name='" << name
-                 << (std::any_cast<bool>(value) ? " checked" : "") << "'>\n";
+                 << (*static_cast<const bool *>(value) ? " checked" : "") << "'>\n";
+            break;
         }
 
         html << "</div>\n";
@@ -89,10 +89,15 @@ std::string generateHtmlForm(const introspection::Introspectable &obj)
     // Add JavaScript for interactivity
     html << "<script>\n";
     html << "function updateObject() {\n";
-    html << "  const formData = new FormData(document.getElementById('objectForm'));\n";
-    html << "  const data = Object.fromEntries(formData);\n";
-    html << "  console.log('Update object with:', data);\n";
-    html << "  // Here we would send data back to C++ via WebSocket/HTTP\n";
+    html << "  const data = {};\n";
+    html << "  for (const input of document.querySelectorAll('#objectForm input')) {\n";
+    html << "    if (input.type === 'checkbox') data[input.name] = input.checked;\n";
+    html << "    else if (input.type === 'number') data[input.name] = Number(input.value);\n";
+    html << "    else data[input.name] = input.value;\n";
+    html << "  }\n";
+    html << "  fetch('/update', { method: 'POST', body: JSON.stringify(data) })\n";
+    html << "    .then(response => response.text())\n";
+    html << "    .then(text => console.log('Update:', text));\n";
     html << "}\n\n";
     html << "function callMethod(methodName) {\n";
     html << "  console.log('Call method:', methodName);\n";
@@ -114,11 +119,21 @@ void launchGui(Introspectable &obj)
 
     server.Post("/update", [&](const httplib::Request &req, httplib::Response &res)
                 {
+        // Body is a {"member": value, ...} object
+        auto errors = obj.fromJSON(req.body);
+        if (errors.empty())
+        {
+            res.set_content("OK", "text/plain");
+            return;
+        }
 
-        // Parse JSON and update object
-        // obj.setMemberValue(name, value);
-
-        res.set_content("OK", "text/plain"); });
+        std::string message;
+        for (const auto &error : errors)
+        {
+            message += error.message + "\n";
+        }
+        res.status = 400;
+        res.set_content(message, "text/plain"); });
 
     server.listen("0.0.0.0", 8080);
 }
\ No newline at end of file
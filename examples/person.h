@@ -19,6 +19,16 @@ public:
     void setNameAgeAndHeight(const std::string &, int, double);
     std::string getDescription() const;
 
+    // Static descriptor: compile-time member access (for_each_member) and
+    // source of the runtime members
+    static constexpr auto staticFields()
+    {
+        using introspection::field;
+        return introspection::describe(field("name", &Person::name),
+                                       field("age", &Person::age),
+                                       field("height", &Person::height));
+    }
+
 private:
     std::string name;
     int age;
@@ -72,9 +82,7 @@ void Person::registerIntrospection(introspection::TypeRegistrar<Person> reg)
     reg
         .constructor<>()                                 // Default constructor
         .constructor<const std::string &, int, double>() // Parameterized constructor
-        .member("name", &Person::name)
-        .member("age", &Person::age)
-        .member("height", &Person::height)
+        .fields(staticFields())
         .method("introduce", &Person::introduce)
         .method("getName", &Person::getName)
         .method("setName", &Person::setName)
@@ -83,6 +83,7 @@ private:
     int year;
     double mileage;
     bool isRunning;
+    std::vector<double> trips; // Miles of each drive
 };
 
 void Vehicle::registerIntrospection(TypeRegistrar<Vehicle> reg)
@@ -95,6 +96,7 @@ void Vehicle::registerIntrospection(TypeRegistrar<Vehicle> reg)
         .member("year", &Vehicle::year)
         .member("mileage", &Vehicle::mileage)
         .member("isRunning", &Vehicle::isRunning)
+        .member("trips", &Vehicle::trips)
         .method("getBrand", &Vehicle::getBrand)
         .method("setBrand", &Vehicle::setBrand)
         .method("getModel", &Vehicle::getModel)
@@ -255,6 +257,7 @@ void Vehicle::drive(double miles)
     if (isRunning)
     {
         mileage += miles;
+        trips.push_back(miles);
         std::cout << "Drove " << miles
                   << " miles. Total mileage: " << mileage << std::endl;
     }
@@ -40,8 +40,15 @@ console.log('Description:', person.getDescription());
 
 vehicle.start();
 vehicle.drive(100.5);
+vehicle.drive(12.25);
 console.log('Info:', vehicle.getInfo());
 vehicle.stop();
+
+// Zero-copy view over a vector<double> member
+const trips = vehicle.getMemberView('trips');
+console.log('Trips (Float64Array view):', Array.from(trips));
+vehicle.trips = new Float64Array([1.5, 2.5]); // Typed arrays convert in one copy
+console.log('Trips after assignment:', vehicle.trips);
 console.log();
 
 // Test introspection utilities
@@ -112,11 +119,7 @@ const personData = {
     isActive: false
 };
 
-Object.keys(personData).forEach(key => {
-    if (person.hasMember(key)) {
-        person.setMemberValue(key, personData[key]);
-    }
-});
+person.setMembers(personData); // One native call for all the members
 
 console.log('After batch update:', person.getDescription());
 console.log();
@@ -38,4 +38,14 @@ print("Person as JSON:", person.to_json())
 # Module utilities
 print("Available classes:", intro.get_all_classes())
 default_person = intro.create_person()
-default_vehicle = intro.create_vehicle()
\ No newline at end of file
+default_vehicle = intro.create_vehicle()
+# Numeric vector members are numpy views over the C++ storage
+trips = vehicle.trips
+print("Trips:", trips)
+if len(trips):
+    trips[0] += 1.0
+    print("First trip after in-place edit:", vehicle.trips[0])
+
+# Gather one member across many objects
+fleet = [vehicle, default_vehicle]
+print("Fleet mileage:", intro.Vehicle.gather(fleet, "mileage"))
@@ -1,10 +1,18 @@
 #include <iostream>
 #include <unordered_map>
 #include "../person.h"
+#include <introspection/catalog.h>
+
+REGISTER_INTROSPECTABLE(Person);
 
 // Example usage
 int main()
 {
+    // Build every catalog TypeInfo up front instead of on first use
+    auto stats = introspection::initializeAll();
+    std::cout << "Registered " << stats.types << " type(s), " << stats.members << " members, "
+              << stats.methods << " methods, " << stats.bytes << " bytes" << std::endl;
+
     Person person("Alice", 30, 1.65);
 
     std::cout << "=== Class Introspection Demo ===" << std::endl;
@@ -46,6 +54,31 @@ int main()
 
     std::cout << std::endl;
 
+    // Resolve handles once, then access members and methods without name lookups
+    std::cout << "=== Handle-based Access ===" << std::endl;
+    auto age_handle = person.getMemberHandle("age");
+    auto introduce_handle = person.getMethodHandle("introduce");
+    person.setMemberValue(age_handle, 23);
+    std::cout << "Age through handle: " << std::any_cast<int>(person.getMemberValue(age_handle)) << std::endl;
+    person.callMethod(introduce_handle);
+
+    // Typed access: no std::any, no copy of the string member
+    auto name_handle = person.getMemberHandle("name");
+    const std::string &name_ref = person.getMemberRef<std::string>(name_handle);
+    std::cout << "Name by reference: " << name_ref << std::endl;
+    person.setMember(name_handle, std::string("Zoe"));
+
+    // Allocation-free call: arguments are passed by reference through a stack frame
+    std::string new_name = "Yann";
+    int new_age = 41;
+    std::array<introspection::ArgView, 2> frame{introspection::ArgView::of(new_name),
+                                                introspection::ArgView::of(new_age)};
+    person.invoke(person.getMethodHandle("setNameAndAge"), frame);
+    auto description = person.call<std::string>(person.getMethodHandle("getDescription"));
+    std::cout << "Description through frame call: " << description << std::endl;
+
+    std::cout << std::endl;
+
     // Demonstrate utility methods
     std::cout << "=== Utility Methods ===" << std::endl;
     std::cout << "Class name: " << person.getClassName() << std::endl;
@@ -68,5 +101,21 @@ int main()
 
     std::cout << person.toJSON() << std::endl;
 
+    // Compact values-only output into a reusable buffer
+    std::string buffer;
+    introspection::JsonWriter json(buffer);
+    person.toJSON(json, introspection::JsonContent::ValuesOnly);
+    std::cout << buffer << std::endl;
+
+    // ...and read it back
+    Person copy;
+    auto errors = copy.fromJSON(buffer);
+    std::cout << "Restored: " << copy.getDescription() << " (" << errors.size() << " errors)" << std::endl;
+
+    // Static descriptor: unrolled at compile time, no TypeInfo lookup
+    std::cout << std::endl << "=== Static Members ===" << std::endl;
+    introspection::for_each_member(copy, [](std::string_view name, const auto &value)
+                                   { std::cout << name << " = " << value << std::endl; });
+
     return 0;
 }
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <signal.h>
+#include <introspection/change_tracked.h>
 #include <introspection/introspectable.h>
 
 // Include the WebSocket GUI implementation
@@ -22,8 +23,9 @@ void signalHandler(int signal)
     exit(0);
 }
 
-// Example class that uses introspection
-class Person : public Introspectable
+// Example class that uses introspection. ChangeTracked lets the server push
+// only the members that changed; direct writes below mark them explicitly.
+class Person : public introspection::ChangeTracked
 {
     INTROSPECTABLE(Person)
 
@@ -40,16 +42,32 @@ public:
 
     // Getters and setters
     std::string getName() const { return name; }
-    void setName(const std::string &n) { name = n; }
+    void setName(const std::string &n)
+    {
+        name = n;
+        markChanged("name");
+    }
 
     int getAge() const { return age; }
-    void setAge(int a) { age = a; }
+    void setAge(int a)
+    {
+        age = a;
+        markChanged("age");
+    }
 
     double getHeight() const { return height; }
-    void setHeight(double h) { height = h; }
+    void setHeight(double h)
+    {
+        height = h;
+        markChanged("height");
+    }
 
     bool getIsActive() const { return isActive; }
-    void setIsActive(bool active) { isActive = active; }
+    void setIsActive(bool active)
+    {
+        isActive = active;
+        markChanged("isActive");
+    }
 
     // Methods for demonstration
     void introduce()
@@ -61,12 +79,14 @@ public:
     void celebrateBirthday()
     {
         age++;
+        markChanged("age");
         std::cout << "🎉 " << name << " is now " << age << " years old!" << std::endl;
     }
 
     void grow(double cm)
     {
         height += cm / 100.0;
+        markChanged("height");
         std::cout << name << " grew " << cm << "cm! Now " << height << "m tall." << std::endl;
     }
 
@@ -79,6 +99,7 @@ public:
     void toggleActive()
     {
         isActive = !isActive;
+        markChanged("isActive");
         std::cout << name << " is now " << (isActive ? "active" : "inactive") << std::endl;
     }
 };
@@ -184,7 +205,7 @@ void example2_with_auto_updates()
     launchWebSocketGUI(person);
 }
 
-// Example 3: Multiple objects (we can extend this)
+// Example 3: Multiple objects served by one server
 void example3_multiple_objects()
 {
     std::cout << "\n=== Example 3: Multiple Objects ===" << std::endl;
@@ -192,11 +213,26 @@ void example3_multiple_objects()
     Person person1("Alice", 25, 1.65);
     Person person2("Bob", 30, 1.80);
 
-    std::cout << "This example shows how you could manage multiple objects" << std::endl;
-    std::cout << "(Implementation would require extending the server)" << std::endl;
+    // The first object registered is the one the page edits; clients
+    // subscribe to the others, or to a subset of their members:
+    //   {"type":"subscribe","object":"bob","members":["age","isActive"]}
+    WebSocketGuiServer server(nullptr, 8080, 500);
+    server.addObject("alice", &person1);
+    server.addObject("bob", &person2);
+
+    std::thread birthdays([&person2]()
+                          {
+        while (true) {
+            std::this_thread::sleep_for(std::chrono::seconds(5));
+            person2.celebrateBirthday();
+        } });
+    birthdays.detach();
 
-    // For now, just use the first person
-    launchWebSocketGUI(person1);
+    std::cout << "Open your browser to: http://localhost:8080 (editing \"alice\")" << std::endl;
+    std::cout << "Send {\"type\":\"list\"} over the WebSocket to list the objects" << std::endl;
+
+    global_server = &server;
+    server.start();
 }
 
 // Example 4: Custom port and settings
@@ -2,13 +2,20 @@
 #include <httplib.h>
 #include <iostream>
 #include <nlohmann/json.hpp>
+#include <introspection/async.h>
 #include <introspection/introspectable.h>
 #include <thread>
 #include <chrono>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <set>
 #include <memory>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
 
 // Simple JSON helper (we can replace with nlohmann/json or jsoncpp)
 class SimpleJson
@@ -43,30 +50,192 @@ public:
     }
 };
 
+// Encoded messages are shared by every client they are queued for
+using SharedMessage = std::shared_ptr<const std::string>;
+
+// Outgoing messages of one client, sent by its own thread so that a slow
+// socket only delays itself. The queue is bounded: when it is full, the
+// pending messages are replaced by the full state of each subscribed object,
+// so a slow client skips intermediate updates instead of buffering them
+// (back-pressure).
+class ClientChannel
+{
+public:
+    ClientChannel(httplib::websocket::connection &conn, std::size_t capacity)
+        : connection(conn), capacity(capacity), sender([this]()
+                                                        { run(); })
+    {
+    }
+
+    ~ClientChannel()
+    {
+        close();
+    }
+
+    // False if the queue is full (the caller then resyncs the client)
+    bool push(SharedMessage message)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (closed)
+                return true;
+            if (queue.size() >= capacity)
+                return false;
+            queue.push_back(std::move(message));
+        }
+        wake.notify_one();
+        return true;
+    }
+
+    // Drop everything pending and queue `messages` alone
+    void reset(std::vector<SharedMessage> messages)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.assign(std::make_move_iterator(messages.begin()), std::make_move_iterator(messages.end()));
+        }
+        wake.notify_one();
+    }
+
+    bool isOpen()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !closed;
+    }
+
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        wake.notify_one();
+        if (sender.joinable() && sender.get_id() != std::this_thread::get_id())
+            sender.join();
+    }
+
+    httplib::websocket::connection &socket() { return connection; }
+
+private:
+    void run()
+    {
+        for (;;)
+        {
+            SharedMessage message;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this]()
+                          { return closed || !queue.empty(); });
+                if (closed)
+                    return;
+                message = std::move(queue.front());
+                queue.pop_front();
+            }
+            try
+            {
+                connection.send(*message);
+            }
+            catch (const std::exception &)
+            {
+                // Connection is dead: stop sending, the server drops it
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+                return;
+            }
+        }
+    }
+
+    httplib::websocket::connection &connection;
+    const std::size_t capacity;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<SharedMessage> queue;
+    bool closed = false;
+    std::thread sender; // Last: started once the rest is initialized
+};
+
+// Serves any number of objects, registered by id. Each client subscribes to
+// objects, optionally to a subset of their members:
+//   {"type":"list"}                                      -> {"type":"objects",...}
+//   {"type":"subscribe","object":"id","members":["a"]}   (no "members": all)
+//   {"type":"unsubscribe","object":"id"}
+// "update" and "method" messages take an optional "object" (default: the
+// primary object, the first one registered, which the GUI page edits). A new
+// client is subscribed to the whole primary object.
+//
+// Each change is encoded once per member; clients receiving the same members
+// of an object share a single message.
 class WebSocketGuiServer
 {
 private:
+    struct Subscription
+    {
+        std::shared_ptr<ClientChannel> client;
+        std::vector<introspection::MemberHandle> members; // Empty: all
+    };
+
+    // A registered object. Change-tracked objects queue themselves for the
+    // push thread when written; the others are compared member by member
+    // against the encodings last sent, every refresh_interval.
+    struct ObservedObject : introspection::ChangeObserver
+    {
+        WebSocketGuiServer *server = nullptr;
+        std::string id;
+        Introspectable *object = nullptr;
+        std::vector<Subscription> subscribers;
+        std::vector<std::string> last_sent; // Untracked: last encoded entry of each member
+        std::atomic<bool> queued{false};
+        std::unique_ptr<introspection::SerialQueue> calls; // Method calls, in arrival order
+        // Held while the server reads or writes the object: method calls run
+        // on the pool, updates and publishing on other threads. Shared with
+        // the queued calls, which may outlive the entry
+        std::shared_ptr<std::mutex> access = std::make_shared<std::mutex>();
+
+        void memberChanged(introspection::MemberHandle) override
+        {
+            if (!queued.exchange(true))
+            {
+                server->objectChanged(id);
+            }
+        }
+    };
+
     httplib::Server server;
-    Introspectable *target_object;
     int port;
 
+    // Object registry, subscriptions included
+    std::mutex objects_mutex;
+    std::map<std::string, std::unique_ptr<ObservedObject>> objects;
+    std::string primary_id;
+
     // WebSocket connection management
     std::mutex connections_mutex;
-    std::set<std::shared_ptr<httplib::websocket::connection>> active_connections;
+    std::set<std::shared_ptr<ClientChannel>> active_connections;
+    std::size_t max_queued_messages;
 
-    // Auto-refresh thread
+    // Push thread: woken by member writes on change-tracked objects, polls
+    // the others every refresh_interval
     std::atomic<bool> running{false};
     std::thread refresh_thread;
     std::chrono::milliseconds refresh_interval{1000}; // 1 second
+    std::chrono::milliseconds coalesce_window{10};   // Changes batched per push
+    std::mutex push_mutex;
+    std::condition_variable push_wake;
+    std::vector<std::string> changed_ids;
 
-    // Object state tracking
-    std::mutex state_mutex;
-    std::string last_state;
+    // Runs the methods called by clients, off the network thread. Last, so
+    // that it is joined before the rest is destroyed.
+    introspection::ThreadPool method_pool{2};
 
 public:
-    WebSocketGuiServer(Introspectable *obj, int p = 8080, int refresh_ms = 1000)
-        : target_object(obj), port(p), refresh_interval(refresh_ms)
+    WebSocketGuiServer(Introspectable *obj, int p = 8080, int refresh_ms = 1000, int coalesce_ms = 10,
+                       std::size_t max_queued = 64)
+        : port(p), max_queued_messages(max_queued), refresh_interval(refresh_ms), coalesce_window(coalesce_ms)
     {
+        if (obj)
+        {
+            addObject("main", obj);
+        }
         setupRoutes();
     }
 
@@ -75,6 +244,56 @@ public:
         stop();
     }
 
+    // Register an object under a unique id. Writes to a change-tracked
+    // object must not race with its removal.
+    void addObject(const std::string &id, Introspectable *obj)
+    {
+        auto entry = std::make_unique<ObservedObject>();
+        entry->server = this;
+        entry->id = id;
+        entry->object = obj;
+        entry->calls = std::make_unique<introspection::SerialQueue>(method_pool);
+        auto *observed = entry.get();
+        {
+            std::lock_guard<std::mutex> lock(objects_mutex);
+            if (!objects.emplace(id, std::move(entry)).second)
+            {
+                throw std::runtime_error("Object '" + id + "' is already registered");
+            }
+            if (primary_id.empty())
+            {
+                primary_id = id;
+            }
+            if (!obj->changeSet())
+            {
+                observed->last_sent = encodeEntries(*obj);
+            }
+        }
+        if (auto *changes = obj->changeSet())
+        {
+            changes->observe(observed);
+        }
+    }
+
+    void removeObject(const std::string &id)
+    {
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        auto it = objects.find(id);
+        if (it == objects.end())
+        {
+            return;
+        }
+        if (auto *changes = it->second->object->changeSet())
+        {
+            changes->observe(nullptr);
+        }
+        objects.erase(it);
+        if (primary_id == id)
+        {
+            primary_id = objects.empty() ? std::string() : objects.begin()->first;
+        }
+    }
+
     void setupRoutes()
     {
         // Serve the main GUI page with WebSocket support
@@ -109,196 +328,231 @@ public:
 
     void handleWebSocketConnection(httplib::websocket::connection &conn)
     {
-        auto connection = std::shared_ptr<httplib::websocket::connection>(&conn, [](auto *) {});
+        auto client = std::make_shared<ClientChannel>(conn, max_queued_messages);
 
         // Add to active connections
+        std::size_t total;
         {
             std::lock_guard<std::mutex> lock(connections_mutex);
-            active_connections.insert(connection);
+            active_connections.insert(client);
+            total = active_connections.size();
         }
 
-        std::cout << "WebSocket client connected. Total connections: " << active_connections.size() << std::endl;
+        std::cout << "WebSocket client connected. Total connections: " << total << std::endl;
 
-        // Send initial object state
-        sendObjectState(conn);
+        // Watch the whole primary object, and send its initial state
+        {
+            std::lock_guard<std::mutex> lock(objects_mutex);
+            if (auto *entry = findObject(primary_id))
+            {
+                subscribe(*entry, client, {});
+            }
+        }
 
         // Handle incoming messages
-        conn.set_message_handler([this, connection](const std::string &message)
-                                 { handleWebSocketMessage(message, *connection); });
+        conn.set_message_handler([this, client](const std::string &message)
+                                 { handleWebSocketMessage(message, client); });
 
-        conn.set_close_handler([this, connection]()
+        conn.set_close_handler([this, client]()
                                {
-            std::lock_guard<std::mutex> lock(connections_mutex);
-            active_connections.erase(connection);
-            std::cout << "WebSocket client disconnected. Remaining connections: " << active_connections.size() << std::endl; });
+            client->close();
+            std::size_t remaining;
+            {
+                std::lock_guard<std::mutex> lock(connections_mutex);
+                active_connections.erase(client);
+                remaining = active_connections.size();
+            }
+            unsubscribeAll(client);
+            std::cout << "WebSocket client disconnected. Remaining connections: " << remaining << std::endl; });
     }
 
-    void handleWebSocketMessage(const std::string &message, httplib::websocket::connection &conn)
+    void handleWebSocketMessage(const std::string &message, const std::shared_ptr<ClientChannel> &client)
     {
         std::cout << "Received WebSocket message: " << message << std::endl;
 
         try
         {
-            // Parse simple JSON-like messages
-            // Format: {"type":"update","field":"name","value":"newvalue"}
-            // Format: {"type":"method","name":"methodName","args":[]}
+            // Formats:
+            //   {"type":"update","object":"id","values":{"name":"newvalue","age":42}}
+            //   {"type":"method","object":"id","name":"methodName"}
+            //   {"type":"subscribe","object":"id","members":["name","age"]}
+            //   {"type":"unsubscribe","object":"id"}
+            //   {"type":"list"}
+            //   {"type":"ping"}
+            std::string type, method_name, object_id;
+            std::vector<std::string> member_names;
+            std::string_view values;
+
+            introspection::JsonReader reader(message);
+            std::string_view key;
+            reader.beginObject();
+            while (reader.nextKey(key))
+            {
+                if (key == "type")
+                    introspection::ValueTraits<std::string>::read(reader.value(), type);
+                else if (key == "name")
+                    introspection::ValueTraits<std::string>::read(reader.value(), method_name);
+                else if (key == "object")
+                    introspection::ValueTraits<std::string>::read(reader.value(), object_id);
+                else if (key == "members")
+                    introspection::ValueTraits<std::vector<std::string>>::read(reader.value(), member_names);
+                else if (key == "values")
+                    values = reader.value();
+                else
+                    reader.skipValue();
+            }
+            if (reader.failed())
+            {
+                throw std::runtime_error(std::string("Malformed message: ") + reader.error());
+            }
 
-            if (message.find("\"type\":\"update\"") != std::string::npos)
+            if (type == "update")
             {
-                handleUpdateMessage(message, conn);
+                handleUpdateMessage(object_id, values, *client);
             }
-            else if (message.find("\"type\":\"method\"") != std::string::npos)
+            else if (type == "method")
             {
-                handleMethodMessage(message, conn);
+                handleMethodMessage(object_id, method_name, client);
             }
-            else if (message.find("\"type\":\"ping\"") != std::string::npos)
+            else if (type == "subscribe")
+            {
+                handleSubscribeMessage(object_id, member_names, client);
+            }
+            else if (type == "unsubscribe")
+            {
+                std::lock_guard<std::mutex> lock(objects_mutex);
+                unsubscribe(requireObject(object_id), client);
+            }
+            else if (type == "list")
+            {
+                sendMessage(*client, generateObjectListMessage());
+            }
+            else if (type == "ping")
             {
                 // Respond to ping with pong
-                sendMessage(conn, "{\"type\":\"pong\"}");
+                sendMessage(*client, "{\"type\":\"pong\"}");
             }
         }
         catch (const std::exception &e)
         {
-            std::string error_msg = "{\"type\":\"error\",\"message\":\"" + std::string(e.what()) + "\"}";
-            sendMessage(conn, error_msg);
+            sendError(*client, e.what());
         }
     }
 
-    void handleUpdateMessage(const std::string &message, httplib::websocket::connection &conn)
+    void handleUpdateMessage(const std::string &object_id, std::string_view values, ClientChannel &client)
     {
-        // Simple parsing for: {"type":"update","field":"name","value":"newvalue"}
-        std::string field, value;
+        std::vector<introspection::JsonError> errors;
+        {
+            std::lock_guard<std::mutex> lock(objects_mutex);
+            auto &entry = requireObject(object_id);
+            {
+                std::lock_guard<std::mutex> object_lock(*entry.access);
+                errors = entry.object->fromJSON(values);
+            }
 
-        auto field_pos = message.find("\"field\":\"");
-        if (field_pos != std::string::npos)
+            // Push the new values to all subscribers right away
+            publish(entry);
+        }
+        for (const auto &error : errors)
         {
-            field_pos += 9; // Skip "field":"
-            auto field_end = message.find("\"", field_pos);
-            field = message.substr(field_pos, field_end - field_pos);
+            sendError(client, error.message);
         }
 
-        auto value_pos = message.find("\"value\":\"");
-        if (value_pos != std::string::npos)
+        if (!errors.empty())
         {
-            value_pos += 9; // Skip "value":"
-            auto value_end = message.find("\"", value_pos);
-            value = message.substr(value_pos, value_end - value_pos);
+            return;
         }
 
-        if (!field.empty())
+        // Send one confirmation per updated field
+        introspection::JsonReader reader(values);
+        std::string_view field;
+        reader.beginObject();
+        while (reader.nextKey(field) && reader.skipValue())
         {
-            updateMemberFromString(field, value);
-
-            // Broadcast updated state to all clients
-            broadcastObjectState();
-
-            // Send confirmation
-            std::string response = "{\"type\":\"update_success\",\"field\":\"" + field + "\"}";
-            sendMessage(conn, response);
+            std::string response;
+            introspection::JsonWriter json(response);
+            json.beginObject().key("type").value("update_success").key("field").value(field).endObject();
+            sendMessage(client, response);
         }
     }
 
-    void handleMethodMessage(const std::string &message, httplib::websocket::connection &conn)
+    // The method runs on the object's serial queue: calls to one object stay
+    // in order, and a long method no longer stalls the network thread. The
+    // object lock keeps it apart from updates and publishing.
+    void handleMethodMessage(const std::string &object_id, const std::string &method_name,
+                             const std::shared_ptr<ClientChannel> &client)
     {
-        // Simple parsing for: {"type":"method","name":"methodName"}
-        std::string method_name;
-
-        auto name_pos = message.find("\"name\":\"");
-        if (name_pos != std::string::npos)
+        if (method_name.empty())
         {
-            name_pos += 8; // Skip "name":"
-            auto name_end = message.find("\"", name_pos);
-            method_name = message.substr(name_pos, name_end - name_pos);
+            return;
         }
-
-        if (!method_name.empty())
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        auto &entry = requireObject(object_id);
+        auto method = entry.object->getMethodHandle(method_name);
+        if (!method)
         {
-            auto result = target_object->callMethod(method_name);
-
-            // Broadcast updated state after method call
-            broadcastObjectState();
-
-            // Send confirmation
-            std::string response = "{\"type\":\"method_success\",\"method\":\"" + method_name + "\"}";
-            sendMessage(conn, response);
+            throw std::runtime_error("Method '" + method_name + "' not found in '" + entry.id + "'");
         }
-    }
-
-    void sendMessage(httplib::websocket::connection &conn, const std::string &message)
-    {
-        conn.send(message);
-    }
-
-    void sendObjectState(httplib::websocket::connection &conn)
-    {
-        std::string state = generateObjectStateMessage();
-        sendMessage(conn, state);
-    }
-
-    void broadcastObjectState()
-    {
-        std::string state = generateObjectStateMessage();
-
-        std::lock_guard<std::mutex> lock(connections_mutex);
-        for (auto it = active_connections.begin(); it != active_connections.end();)
-        {
+        entry.calls->submit([this, object = entry.object, access = entry.access, id = entry.id, method, method_name,
+                             client]()
+                            {
             try
             {
-                (*it)->send(state);
-                ++it;
+                std::lock_guard<std::mutex> object_lock(*access);
+                object->callMethod(method);
             }
-            catch (const std::exception &)
+            catch (const std::exception &e)
             {
-                // Connection is dead, remove it
-                it = active_connections.erase(it);
+                sendError(*client, e.what());
+                return;
             }
-        }
+            {
+                // Push the state after the call to all subscribers
+                std::lock_guard<std::mutex> lock(objects_mutex);
+                if (auto *entry = findObject(id))
+                    publish(*entry);
+            }
+
+            // Send confirmation
+            std::string response;
+            introspection::JsonWriter json(response);
+            json.beginObject().key("type").value("method_success").key("method").value(method_name).endObject();
+            sendMessage(*client, response); });
     }
 
-    std::string generateObjectStateMessage()
+    void handleSubscribeMessage(const std::string &object_id, const std::vector<std::string> &member_names,
+                                const std::shared_ptr<ClientChannel> &client)
     {
-        const auto &type_info = target_object->getTypeInfo();
-        std::string json = "{\"type\":\"state\",\"className\":\"" + type_info.class_name + "\",\"members\":{";
-
-        auto member_names = type_info.getMemberNames();
-        for (size_t i = 0; i < member_names.size(); ++i)
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        auto &entry = requireObject(object_id);
+        const auto &type_info = entry.object->getTypeInfo();
+        std::vector<introspection::MemberHandle> members;
+        for (const auto &name : member_names)
         {
-            const auto *member = type_info.getMember(member_names[i]);
-            auto value = member->getter(target_object);
-
-            json += "\"" + member->name + "\":{";
-            json += "\"type\":\"" + member->type_name + "\",";
-            json += "\"value\":";
-
-            if (member->type_name == "string")
-            {
-                json += "\"" + std::any_cast<std::string>(value) + "\"";
-            }
-            else if (member->type_name == "int")
-            {
-                json += std::to_string(std::any_cast<int>(value));
-            }
-            else if (member->type_name == "double")
-            {
-                json += std::to_string(std::any_cast<double>(value));
-            }
-            else if (member->type_name == "bool")
-            {
-                json += (std::any_cast<bool>(value) ? "true" : "false");
-            }
-            else
+            auto handle = type_info.findMember(name);
+            if (!handle)
             {
-                json += "null";
+                throw std::runtime_error("Member '" + name + "' not found in '" + entry.id + "'");
             }
-
-            json += "}";
-            if (i < member_names.size() - 1)
-                json += ",";
+            members.push_back(handle);
         }
+        std::sort(members.begin(), members.end(), [](auto a, auto b)
+                  { return a.index < b.index; });
+        subscribe(entry, client, std::move(members));
+    }
 
-        json += "},\"timestamp\":" + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count()) + "}";
+    void sendError(ClientChannel &client, std::string_view message)
+    {
+        std::string response;
+        introspection::JsonWriter json(response);
+        json.beginObject().key("type").value("error").key("message").value(message).endObject();
+        sendMessage(client, response);
+    }
 
-        return json;
+    void sendMessage(ClientChannel &client, std::string message)
+    {
+        // Replies are not worth a resync: a client that far behind misses them
+        client.push(std::make_shared<const std::string>(std::move(message)));
     }
 
     void startAutoRefresh()
@@ -306,20 +560,39 @@ public:
         running = true;
         refresh_thread = std::thread([this]()
                                      {
+            auto next_poll = std::chrono::steady_clock::now() + refresh_interval;
             while (running) {
-                std::this_thread::sleep_for(refresh_interval);
-                
-                if (!active_connections.empty()) {
-                    std::string current_state = generateObjectStateMessage();
-                    
-                    {
-                        std::lock_guard<std::mutex> lock(state_mutex);
-                        if (current_state != last_state) {
-                            last_state = current_state;
-                            broadcastObjectState();
-                        }
+                std::vector<std::string> ids;
+                bool changed;
+                {
+                    // Sleep until a member write or the next poll
+                    std::unique_lock<std::mutex> lock(push_mutex);
+                    push_wake.wait_until(lock, next_poll, [this]() { return !changed_ids.empty() || !running; });
+                    if (!running)
+                        break;
+                    changed = !changed_ids.empty();
+                }
+                if (changed) {
+                    // Let the window fill up, then take everything queued
+                    std::this_thread::sleep_for(coalesce_window);
+                    std::lock_guard<std::mutex> lock(push_mutex);
+                    ids.swap(changed_ids);
+                }
+
+                std::lock_guard<std::mutex> lock(objects_mutex);
+                for (const auto &id : ids) {
+                    if (auto *entry = findObject(id)) {
+                        entry->queued = false; // Before collecting: later writes queue it again
+                        publish(*entry);
                     }
                 }
+                if (std::chrono::steady_clock::now() >= next_poll) {
+                    for (auto &[id, entry] : objects) {
+                        if (!entry->object->changeSet() && !entry->subscribers.empty())
+                            publish(*entry);
+                    }
+                    next_poll = std::chrono::steady_clock::now() + refresh_interval;
+                }
             } });
     }
 
@@ -337,7 +610,19 @@ public:
 
     void stop()
     {
-        running = false;
+        {
+            std::lock_guard<std::mutex> lock(objects_mutex);
+            for (auto &[id, entry] : objects)
+            {
+                if (auto *changes = entry->object->changeSet())
+                    changes->observe(nullptr);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(push_mutex);
+            running = false;
+        }
+        push_wake.notify_all();
         if (refresh_thread.joinable())
         {
             refresh_thread.join();
@@ -345,96 +630,294 @@ public:
         server.stop();
 
         // Close all WebSocket connections
-        std::lock_guard<std::mutex> lock(connections_mutex);
-        for (auto &conn : active_connections)
         {
-            try
-            {
-                conn->close();
-            }
-            catch (...)
+            std::lock_guard<std::mutex> lock(connections_mutex);
+            for (auto &client : active_connections)
             {
-                // Ignore errors during shutdown
+                client->close();
+                try
+                {
+                    client->socket().close();
+                }
+                catch (...)
+                {
+                    // Ignore errors during shutdown
+                }
             }
+            active_connections.clear();
+        }
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        for (auto &[id, entry] : objects)
+        {
+            entry->subscribers.clear();
         }
-        active_connections.clear();
     }
 
 private:
-    std::string generateObjectJson()
+    // Called on the writing thread by ObservedObject: only wakes the push thread
+    void objectChanged(const std::string &id)
     {
-        // Same as before, kept for REST API compatibility
-        const auto &type_info = target_object->getTypeInfo();
-        std::string json = "{\"className\": \"" + type_info.class_name + "\",\"members\": {";
+        {
+            std::lock_guard<std::mutex> lock(push_mutex);
+            changed_ids.push_back(id);
+        }
+        push_wake.notify_one();
+    }
 
-        auto member_names = type_info.getMemberNames();
-        for (size_t i = 0; i < member_names.size(); ++i)
+    // Registry helpers, called with objects_mutex held --------------------
+
+    ObservedObject *findObject(const std::string &id)
+    {
+        auto it = objects.find(id.empty() ? primary_id : id);
+        return it == objects.end() ? nullptr : it->second.get();
+    }
+
+    ObservedObject &requireObject(const std::string &id)
+    {
+        auto *entry = findObject(id);
+        if (!entry)
         {
-            const auto *member = type_info.getMember(member_names[i]);
-            auto value = member->getter(target_object);
+            throw std::runtime_error("Unknown object '" + id + "'");
+        }
+        return *entry;
+    }
 
-            json += "\"" + member->name + "\": {";
-            json += "\"type\": \"" + member->type_name + "\",";
-            json += "\"value\": ";
+    void subscribe(ObservedObject &entry, const std::shared_ptr<ClientChannel> &client,
+                   std::vector<introspection::MemberHandle> members)
+    {
+        unsubscribe(entry, client);
+        entry.subscribers.push_back({client, std::move(members)});
+        // Queued behind what is pending, which may concern other objects
+        if (!client->push(generateObjectStateMessage(entry, entry.subscribers.back().members)))
+            resync(client);
+    }
 
-            if (member->type_name == "string")
+    // Replace what a client that fell behind has pending with the state of
+    // every object it subscribes to
+    void resync(const std::shared_ptr<ClientChannel> &client)
+    {
+        std::vector<SharedMessage> states;
+        for (auto &[id, entry] : objects)
+        {
+            for (const auto &subscription : entry->subscribers)
             {
-                json += "\"" + std::any_cast<std::string>(value) + "\"";
+                if (subscription.client == client)
+                    states.push_back(generateObjectStateMessage(*entry, subscription.members));
             }
-            else if (member->type_name == "int")
+        }
+        client->reset(std::move(states));
+    }
+
+    void unsubscribe(ObservedObject &entry, const std::shared_ptr<ClientChannel> &client)
+    {
+        auto &subscribers = entry.subscribers;
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), [&](const Subscription &subscription)
+                                         { return subscription.client == client; }),
+                          subscribers.end());
+    }
+
+    void unsubscribeAll(const std::shared_ptr<ClientChannel> &client)
+    {
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        for (auto &[id, entry] : objects)
+        {
+            unsubscribe(*entry, client);
+        }
+    }
+
+    // Send the changed members of an object to its subscribers. Each member
+    // entry is encoded once, and each distinct set of members once.
+    void publish(ObservedObject &entry)
+    {
+        const auto &type_info = entry.object->getTypeInfo();
+        std::vector<introspection::MemberHandle> changed;
+        std::vector<std::string> entries(type_info.members.size());
+        std::unique_lock<std::mutex> object_lock(*entry.access);
+        if (auto *changes = entry.object->changeSet())
+        {
+            changes->consume(type_info.members.size(), [&](introspection::MemberHandle member)
+                             {
+                changed.push_back(member);
+                appendMemberEntry(entries[member.index], *entry.object, type_info.memberAt(member)); });
+        }
+        else
+        {
+            entries = encodeEntries(*entry.object);
+            for (std::size_t i = 0; i < entries.size(); ++i)
             {
-                json += std::to_string(std::any_cast<int>(value));
+                if (entries[i] != entry.last_sent[i])
+                    changed.push_back(introspection::MemberHandle{static_cast<std::uint32_t>(i)});
             }
-            else if (member->type_name == "double")
+            entry.last_sent = entries;
+        }
+        object_lock.unlock();
+        if (changed.empty())
+        {
+            return;
+        }
+
+        std::map<std::vector<std::uint32_t>, SharedMessage> messages; // Members sent -> message
+        std::vector<std::shared_ptr<ClientChannel>> behind;
+        for (auto it = entry.subscribers.begin(); it != entry.subscribers.end();)
+        {
+            if (!it->client->isOpen())
             {
-                json += std::to_string(std::any_cast<double>(value));
+                it = entry.subscribers.erase(it);
+                continue;
             }
-            else if (member->type_name == "bool")
+            std::vector<std::uint32_t> visible;
+            for (auto member : changed)
             {
-                json += (std::any_cast<bool>(value) ? "true" : "false");
+                if (it->members.empty() || std::binary_search(it->members.begin(), it->members.end(), member,
+                                                              [](auto a, auto b)
+                                                              { return a.index < b.index; }))
+                    visible.push_back(member.index);
             }
-            else
+            if (!visible.empty())
             {
-                json += "null";
+                auto &message = messages[visible];
+                if (!message)
+                    message = composeMessage("changes", entry, visible, entries);
+                if (!it->client->push(message))
+                    behind.push_back(it->client);
             }
+            ++it;
+        }
+        for (const auto &client : behind)
+        {
+            resync(client);
+        }
+    }
 
-            json += "}";
-            if (i < member_names.size() - 1)
-                json += ",";
+    // `"name":{"type":"...","value":...}` entries of every member
+    std::vector<std::string> encodeEntries(Introspectable &object)
+    {
+        const auto &type_info = object.getTypeInfo();
+        std::vector<std::string> entries(type_info.members.size());
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            appendMemberEntry(entries[i], object, type_info.members[i]);
         }
+        return entries;
+    }
 
-        json += "}}";
-        return json;
+    void appendMemberEntry(std::string &json, Introspectable &object, const introspection::MemberInfo &member)
+    {
+        json += "\"" + member.name + "\":{";
+        json += "\"type\":\"" + member.type_name + "\",";
+        json += "\"value\":";
+        appendMemberValue(json, object, member);
+        json += "}";
     }
 
-    void updateMemberFromString(const std::string &field, const std::string &value)
+    // {"type":...,"object":"id","className":...,"members":{...},"timestamp":...}
+    SharedMessage composeMessage(const char *type, const ObservedObject &entry,
+                                 const std::vector<std::uint32_t> &members, const std::vector<std::string> &entries)
     {
-        const auto *member = target_object->getTypeInfo().getMember(field);
-        if (!member)
+        std::string json = std::string("{\"type\":\"") + type + "\",\"object\":\"" + entry.id + "\",\"className\":\"" +
+                           entry.object->getTypeInfo().class_name + "\",\"members\":{";
+        for (std::size_t i = 0; i < members.size(); ++i)
         {
-            throw std::runtime_error("Unknown field: " + field);
+            if (i > 0)
+                json += ",";
+            json += entries[members[i]];
         }
+        json += "},\"timestamp\":" + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count()) + "}";
+        return std::make_shared<const std::string>(std::move(json));
+    }
 
-        if (member->type_name == "string")
+    // Full state of the given members (all if empty)
+    SharedMessage generateObjectStateMessage(ObservedObject &entry, const std::vector<introspection::MemberHandle> &members)
+    {
+        std::unique_lock<std::mutex> object_lock(*entry.access);
+        const auto entries = encodeEntries(*entry.object);
+        object_lock.unlock();
+        std::vector<std::uint32_t> indexes;
+        for (std::size_t i = 0; i < entries.size(); ++i)
         {
-            target_object->setMemberValue(field, value);
+            indexes.push_back(static_cast<std::uint32_t>(i));
         }
-        else if (member->type_name == "int")
+        if (!members.empty())
         {
-            target_object->setMemberValue(field, std::stoi(value));
+            indexes.clear();
+            for (auto member : members)
+                indexes.push_back(member.index);
         }
-        else if (member->type_name == "double")
+        return composeMessage("state", entry, indexes, entries);
+    }
+
+    std::string generateObjectListMessage()
+    {
+        std::string response;
+        introspection::JsonWriter json(response);
+        json.beginObject().key("type").value("objects").key("objects").beginArray();
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        for (const auto &[id, entry] : objects)
         {
-            target_object->setMemberValue(field, std::stod(value));
+            json.beginObject().key("id").value(id).key("className").value(entry->object->getTypeInfo().class_name).endObject();
         }
-        else if (member->type_name == "bool")
+        json.endArray().endObject();
+        return response;
+    }
+
+    Introspectable *primaryObject()
+    {
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        auto *entry = findObject(primary_id);
+        return entry ? entry->object : nullptr;
+    }
+
+    std::string generateObjectJson()
+    {
+        // Same as before, kept for REST API compatibility
+        std::lock_guard<std::mutex> lock(objects_mutex);
+        auto *entry = findObject(primary_id);
+        if (!entry)
         {
-            target_object->setMemberValue(field, value == "true" || value == "1");
+            return "{}";
         }
+        std::lock_guard<std::mutex> object_lock(*entry->access);
+        auto *target_object = entry->object;
+        const auto &type_info = target_object->getTypeInfo();
+        std::string json = "{\"className\": \"" + type_info.class_name + "\",\"members\": {";
+
+        auto member_names = type_info.getMemberNames();
+        for (size_t i = 0; i < member_names.size(); ++i)
+        {
+            const auto *member = type_info.getMember(member_names[i]);
+
+            json += "\"" + member->name + "\": {";
+            json += "\"type\": \"" + member->type_name + "\",";
+            json += "\"value\": ";
+            appendMemberValue(json, *target_object, *member);
+
+            json += "}";
+            if (i < member_names.size() - 1)
+                json += ",";
+        }
+
+        json += "}}";
+        return json;
+    }
+
+    void appendMemberValue(std::string &json, Introspectable &object, const introspection::MemberInfo &member)
+    {
+        const auto *codec = member.codec();
+        if (!codec)
+        {
+            json += "null";
+            return;
+        }
+        codec->write(json, member.address(&object));
     }
 
     std::string generateWebSocketPage()
     {
+        auto *target_object = primaryObject();
+        if (!target_object)
+        {
+            return "<!DOCTYPE html><html><body><p>No object registered</p></body></html>";
+        }
         const auto &type_info = target_object->getTypeInfo();
         std::string html = R"(<!DOCTYPE html>
 <html lang="en">
@@ -470,21 +953,20 @@ private:
                     <label for=")" +
                     name + R"(">)" + name + R"( <span class="type-hint">()" + member->type_name + R"()</span>:</label>)";
 
-            if (member->type_name == "string")
+            switch (member->type_id)
             {
+            case introspection::typeId<std::string>():
                 html += R"(<input type="text" id=")" + name + R"(" name=")" + name + R"(" data-type="string">)";
-            }
-            else if (member->type_name == "int")
-            {
+                break;
+            case introspection::typeId<int>():
                 html += R"(<input type="number" id=")" + name + R"(" name=")" + name + R"(" data-type="int">)";
-            }
-            else if (member->type_name == "double")
-            {
+                break;
+            case introspection::typeId<double>():
                 html += R"(<input type="number" step="0.01" id=")" + name + R"(" name=")" + name + R"(" data-type="double">)";
-            }
-            else if (member->type_name == "bool")
-            {
+                break;
+            case introspection::typeId<bool>():
                 html += R"(<input type="checkbox" id=")" + name + R"(" name=")" + name + R"(" data-type="bool">)";
+                break;
             }
 
             html += R"(
@@ -877,6 +1359,7 @@ class WebSocketGUI {
     handleMessage(message) {
         switch (message.type) {
             case 'state':
+            case 'changes':
                 this.updateObjectState(message);
                 break;
             case 'update_success':
@@ -890,6 +1373,9 @@ class WebSocketGUI {
             case 'error':
                 this.log('error', `✗ ${message.message}`);
                 break;
+            case 'objects':
+                this.log('connection', `Objects: ${message.objects.map(o => `${o.id} (${o.className})`).join(', ')}`);
+                break;
             case 'pong':
                 // Heartbeat response - connection is alive
                 console.debug('Heartbeat received');
@@ -900,6 +1386,11 @@ class WebSocketGUI {
     }
     
     updateObjectState(state) {
+        // The form edits the object of the first state received (the primary one)
+        this.objectId = this.objectId || state.object;
+        if (state.object !== this.objectId) {
+            return;
+        }
         this.isUpdatingFromServer = true;
         
         try {
@@ -1041,8 +1532,7 @@ class WebSocketGUI {
     updateMember(fieldName, value) {
         const message = {
             type: 'update',
-            field: fieldName,
-            value: String(value)
+            values: { [fieldName]: value }
         };
         
         if (this.sendMessage(message)) {
@@ -1,7 +1,9 @@
 #pragma once
+#include <introspection/batch.h>
 #include <introspection/introspectable.h>
 #include <memory>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <typeinfo>
@@ -44,6 +46,10 @@ namespace py = pybind11;
  * vehicle.start()
  * vehicle.drive(100.5)
  * print(vehicle.get_info())
+ *
+ * # vector<double> / vector<float> / vector<int> members are numpy views
+ * vehicle.trips[0] = 90.0              # Writes the C++ vector
+ * I.Vehicle.gather(fleet, "mileage")   # One ndarray for many objects
  * ```
  */
 class PyGenerator
@@ -78,20 +84,34 @@ private:
     template <typename T>
     void bind_members(py::class_<T> &py_class, const introspection::TypeInfo &type_info);
 
+    // Contiguous numeric vector member exposed as an ndarray aliasing its storage
+    template <typename T, typename E>
+    void bind_vector_member(py::class_<T> &py_class, const introspection::MemberInfo &member,
+                            introspection::MemberHandle handle);
+
     template <typename T>
     void bind_methods(py::class_<T> &py_class, const introspection::TypeInfo &type_info);
 
+    // Class-level gather(objects, member_name) -> ndarray
+    template <typename T>
+    void bind_gather(py::class_<T> &py_class);
+
     template <typename T>
     void bind_introspection_utilities(py::class_<T> &py_class);
 
     // Helper function to check if a method is a getter/setter
     bool is_getter_setter_method(const std::string &) const;
 
-    // Convert std::any to Python object based on type name
-    py::object convert_any_to_python(const std::any &, const std::string &) const;
+    // Convert std::any to Python object based on type id (name is used for errors)
+    py::object convert_any_to_python(const std::any &, introspection::TypeId, const std::string &) const;
+
+    // Convert Python object to std::any based on expected type id
+    std::any convert_python_to_any(py::object, introspection::TypeId, const std::string &) const;
 
-    // Convert Python object to std::any based on expected type
-    std::any convert_python_to_any(py::object, const std::string &) const;
+    // Convert constructor arguments into boxes viewed by a frame, false if
+    // one of them does not convert to its parameter type
+    bool convert_python_arguments(const py::args &, const introspection::ConstructorInfo &,
+                                  std::any *boxes, introspection::ArgView *views) const;
 };
 
 // Convenience macro for auto-binding
@@ -0,0 +1,177 @@
+#pragma once
+#include <introspection/introspectable.h>
+#include <cstddef>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Storage provider for objects constructed through reflection
+     * (createObject(), clone(), BinaryReader::readObject()). The owning ObjectHandle
+     * gives the memory back to the allocator that provided it.
+     */
+    class ObjectAllocator
+    {
+    public:
+        virtual ~ObjectAllocator() = default;
+
+        virtual void *allocate(std::size_t size, std::size_t alignment) = 0;
+        virtual void deallocate(void *pointer, std::size_t size, std::size_t alignment) = 0;
+    };
+
+    /**
+     * @brief One aligned operator new per object, the default allocator
+     */
+    class HeapAllocator : public ObjectAllocator
+    {
+    public:
+        static HeapAllocator &instance();
+
+        void *allocate(std::size_t size, std::size_t alignment) override;
+        void deallocate(void *pointer, std::size_t size, std::size_t alignment) override;
+    };
+
+    /**
+     * @brief Fixed-size blocks for the objects of one type, carved out of
+     * chunks of `objects_per_chunk` blocks and recycled through a free list.
+     * Memory goes back to the system when the pool is destroyed, so the pool
+     * must outlive the handles it backs. Not thread-safe.
+     */
+    class ObjectPool : public ObjectAllocator
+    {
+    public:
+        explicit ObjectPool(const TypeInfo &type, std::size_t objects_per_chunk = 1024);
+        ObjectPool(const ObjectPool &) = delete;
+        ObjectPool &operator=(const ObjectPool &) = delete;
+        ~ObjectPool() override;
+
+        // Throws std::runtime_error if the request does not fit a block
+        void *allocate(std::size_t size, std::size_t alignment) override;
+        void deallocate(void *pointer, std::size_t size, std::size_t alignment) override;
+
+        std::size_t live() const { return live_objects; }
+        std::size_t chunks() const { return chunk_list.size(); }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        std::size_t block_size;
+        std::size_t block_alignment;
+        std::size_t blocks_per_chunk;
+        std::vector<void *> chunk_list;
+        FreeBlock *free_list = nullptr;
+        std::size_t next_block = 0; // In the last chunk
+        std::size_t live_objects = 0;
+    };
+
+    /**
+     * @brief Bump allocator for batch loads: objects of any type are packed
+     * into blocks of `bytes_per_block` bytes and deallocate() is a no-op. All the
+     * memory is released at once by reset() or the destructor, which must only
+     * happen once every object placed in the arena has been destroyed (their
+     * handles run the destructors). Not thread-safe.
+     */
+    class Arena : public ObjectAllocator
+    {
+    public:
+        explicit Arena(std::size_t bytes_per_block = std::size_t{1} << 20);
+        Arena(const Arena &) = delete;
+        Arena &operator=(const Arena &) = delete;
+        ~Arena() override;
+
+        void *allocate(std::size_t size, std::size_t alignment) override;
+        void deallocate(void *, std::size_t, std::size_t) override {}
+
+        void reset();
+        std::size_t used() const { return bytes_used; }
+        std::size_t blocks() const { return block_list.size(); }
+
+    private:
+        struct Block
+        {
+            void *data;
+            std::size_t size;
+        };
+
+        std::size_t block_size;
+        std::vector<Block> block_list;
+        std::size_t offset = 0; // In the last block
+        std::size_t bytes_used = 0;
+    };
+
+    /**
+     * @brief Owning, type-erased pointer to an object constructed through
+     * reflection. Destroying or resetting the handle runs the destructor from
+     * the TypeInfo and returns the storage to the allocator it came from.
+     * @example
+     * ```c++
+     * Arena arena;
+     * std::vector<ObjectHandle> players;
+     * BinaryReader reader(buffer);
+     * while (!reader.atEnd())
+     *     players.push_back(reader.readObject(arena));
+     *
+     * ObjectHandle p = createObject(Player::getStaticTypeInfo(), pool);
+     * p.as<Player>()->heal();
+     * ```
+     */
+    class ObjectHandle
+    {
+    public:
+        ObjectHandle() = default;
+        ObjectHandle(void *object, const TypeInfo &type, ObjectAllocator &allocator)
+            : pointer(object), type_info(&type), owner(&allocator) {}
+        ObjectHandle(const ObjectHandle &) = delete;
+        ObjectHandle &operator=(const ObjectHandle &) = delete;
+        ObjectHandle(ObjectHandle &&other) noexcept;
+        ObjectHandle &operator=(ObjectHandle &&other) noexcept;
+        ~ObjectHandle() { reset(); }
+
+        void *get() const { return pointer; }
+        const TypeInfo *type() const { return type_info; }
+        ObjectAllocator *allocator() const { return owner; }
+        explicit operator bool() const { return pointer != nullptr; }
+
+        // nullptr if the class does not derive from Introspectable
+        Introspectable *introspectable() const;
+
+        // nullptr unless the object is exactly a T
+        template <typename T>
+        T *as() const;
+
+        void reset();
+
+        // Give up ownership: the caller destroys and deallocates the object
+        void *release();
+
+    private:
+        void *pointer = nullptr;
+        const TypeInfo *type_info = nullptr;
+        ObjectAllocator *owner = nullptr;
+    };
+
+    /**
+     * @brief Construct an object of `type` in storage from `allocator`.
+     * The first form default-constructs it; the second selects the registered
+     * constructor whose parameter types match the frame exactly. Throws
+     * std::runtime_error if there is no such constructor; the storage is
+     * released if the constructor throws.
+     */
+    ObjectHandle createObject(const TypeInfo &type, ObjectAllocator &allocator = HeapAllocator::instance());
+    ObjectHandle createObject(const TypeInfo &type, ArgFrame args,
+                              ObjectAllocator &allocator = HeapAllocator::instance());
+
+    /**
+     * @brief Deep copy of `source` in storage from `allocator`, with the class
+     * copy constructor when it has one, otherwise default-constructed and
+     * assigned memberwise (Introspectable::copyMembersFrom()).
+     */
+    ObjectHandle clone(const Introspectable &source, ObjectAllocator &allocator = HeapAllocator::instance());
+
+}
+
+#include "inline/allocator.hxx"
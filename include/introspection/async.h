@@ -0,0 +1,152 @@
+#pragma once
+#include <introspection/batch.h>
+#include <introspection/introspectable.h>
+#include <introspection/thread_pool.h>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+
+namespace introspection
+{
+
+    /**
+     * @brief Anything that runs tasks, on some thread, in its own time:
+     * ThreadPool, SerialQueue or an event loop adapter.
+     */
+    template <typename E>
+    concept Executor = requires(E &executor, std::function<void()> task) { executor.submit(std::move(task)); };
+
+    /**
+     * @brief Tasks run one at a time and in submission order on the threads
+     * of a ThreadPool: give each object its own queue, and the calls queued
+     * for it never overlap, while different objects still run in parallel.
+     * Code touching the object outside the queue still needs its own
+     * synchronization. Task exceptions are not
+     * caught (callMethodAsync() catches its own). The tasks own the queue
+     * state, so the queue may be destroyed with tasks pending; the pool must
+     * outlive them.
+     */
+    class SerialQueue
+    {
+    public:
+        explicit SerialQueue(ThreadPool &pool);
+        SerialQueue(const SerialQueue &) = delete;
+        SerialQueue &operator=(const SerialQueue &) = delete;
+
+        void submit(std::function<void()> task);
+
+    private:
+        struct State
+        {
+            ThreadPool *pool;
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+            bool draining = false; // A pool task is running the queue
+        };
+
+        static void drain(const std::shared_ptr<State> &state);
+
+        std::shared_ptr<State> state;
+    };
+
+    namespace detail
+    {
+        struct AsyncState
+        {
+            std::mutex mutex;
+            std::condition_variable done_signal;
+            bool done = false;
+            Arg result;
+            std::exception_ptr error;
+            std::function<void()> continuation;
+
+            void complete(Arg value, std::exception_ptr exception);
+            // false if already done: the caller goes on itself
+            bool chain(std::function<void()> next);
+        };
+    }
+
+    /**
+     * @brief Result of callMethodAsync(): waited on like a future, or
+     * co_awaited from a coroutine, which then resumes on the thread that ran
+     * the method. get() (or co_await) returns the value once, and rethrows
+     * the exception of the method.
+     * @example
+     * ```c++
+     * Task handle(Player &player, SerialQueue &calls) {       // Any coroutine type
+     *     std::any damage = co_await callMethodAsync(player, attack, {target}, calls);
+     *     ...
+     * }
+     * ```
+     */
+    class AsyncResult
+    {
+    public:
+        AsyncResult() = default;
+        explicit AsyncResult(std::shared_ptr<detail::AsyncState> shared) : state(std::move(shared)) {}
+
+        bool valid() const { return state != nullptr; }
+        bool ready() const;
+        void wait() const;
+        Arg get();
+
+        /**
+         * @brief Call `continuation` once the method has returned, on the
+         * thread that ran it, or right away if it already has. One per result.
+         */
+        void then(std::function<void()> continuation);
+
+        bool await_ready() const { return ready(); }
+        bool await_suspend(std::coroutine_handle<> coroutine);
+        Arg await_resume() { return get(); }
+
+    private:
+        std::shared_ptr<detail::AsyncState> state;
+    };
+
+    /**
+     * @brief callMethod() on `executor` rather than the calling thread, e.g.
+     * to keep long-running methods off an I/O thread. The method and the
+     * argument count are checked before anything is queued (std::runtime_error);
+     * errors of the call itself come out of AsyncResult::get(). The object
+     * must outlive the call.
+     */
+    template <Executor E>
+    AsyncResult callMethodAsync(Introspectable &object, MethodHandle method, Args args, E &executor);
+    template <Executor E>
+    AsyncResult callMethodAsync(Introspectable &object, const std::string &method_name, Args args, E &executor);
+
+    inline constexpr std::size_t default_invoke_chunk = 16;
+
+    /**
+     * @brief invoke() of one method on every object, spread across the pool
+     * (or on the calling thread without one). The threads claim `min_chunk`
+     * objects at a time from a shared counter until none remain, so calls of
+     * uneven cost still keep every thread busy. The class of every object is
+     * checked first, as in batch.h. All the calls share `args`, read-only:
+     * by-value parameters get copies, while non-const and rvalue reference
+     * parameters are rejected. Every object is called; the first exception
+     * is rethrown afterwards. Must not be called from a task of the pool.
+     * @example
+     * ```c++
+     * ThreadPool pool;
+     * parallelInvoke(std::span<GameObject>(objects), update_handle, {}, &pool);
+     * ```
+     */
+    void parallelInvoke(std::span<Introspectable *const> objects, MethodHandle method, ArgFrame args = {},
+                        ThreadPool *pool = nullptr, std::size_t min_chunk = default_invoke_chunk);
+    template <typename T>
+    void parallelInvoke(std::span<T> objects, MethodHandle method, ArgFrame args = {}, ThreadPool *pool = nullptr,
+                        std::size_t min_chunk = default_invoke_chunk);
+
+}
+
+#include "inline/async.hxx"
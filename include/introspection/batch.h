@@ -0,0 +1,79 @@
+#pragma once
+#include <introspection/bulk.h>
+#include <introspection/introspectable.h>
+#include <introspection/thread_pool.h>
+#include <cstddef>
+#include <span>
+
+namespace introspection
+{
+
+    /**
+     * @brief Batch get/set of members over many objects in one call: the
+     * collection-level counterpart of Introspectable::getMembers() and
+     * Introspectable::setMembers(). Handles, value types and (for the
+     * Introspectable overloads) the class of every object are checked once for
+     * the whole batch, before the first write, then the values are copied
+     * without further lookups. Given a ThreadPool, the objects are partitioned
+     * across its threads in chunks of at least `min_chunk` objects.
+     *
+     * Values are laid out row-major: the values of object i are
+     * values[i * members.size() ... (i + 1) * members.size()).
+     * @example
+     * ```c++
+     * ThreadPool pool;
+     * auto position = GameObject::getStaticTypeInfo().findMember("position");
+     * std::vector<Vector3D> positions = simulate(objects);   // One per object
+     * batch::setMember<Vector3D>(std::span<GameObject>(objects), position,
+     *                            std::span<const Vector3D>(positions), &pool);
+     * ```
+     */
+    namespace batch
+    {
+        inline constexpr std::size_t default_chunk = 4096;
+
+        // Dynamic forms, for objects only known as Introspectable
+        void getMembers(std::span<const Introspectable *const> objects, std::span<const MemberHandle> members,
+                        std::span<Arg> out, ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+        void setMembers(std::span<Introspectable *const> objects, std::span<const MemberHandle> members,
+                        std::span<const Arg> values, ThreadPool *pool = nullptr,
+                        std::size_t min_chunk = default_chunk);
+        void setMembers(std::span<Introspectable *const> objects, std::span<const MemberHandle> members,
+                        ArgFrame values, ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+
+        /**
+         * @brief Copy `members` (every member when empty) of sources[i] into
+         * targets[i], marking them changed, e.g. to refresh a copy-on-write
+         * snapshot of a population. The copy is planned once for the batch:
+         * trivially copyable members adjacent in the class layout are merged
+         * into single memcpy runs, the others use their copy assignment.
+         */
+        void copyMembers(std::span<const Introspectable *const> sources, std::span<Introspectable *const> targets,
+                         std::span<const MemberHandle> members = {}, ThreadPool *pool = nullptr,
+                         std::size_t min_chunk = default_chunk);
+        template <typename T>
+        void copyMembers(std::span<const T> sources, std::span<T> targets, std::span<const MemberHandle> members = {},
+                         ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+
+        /**
+         * @brief Typed forms over one member of objects of a known class: a
+         * partitioned bulk::gather() / bulk::scatter(). M must be exactly the
+         * member type.
+         */
+        template <typename M, typename T>
+        void getMember(std::span<const T> objects, MemberHandle member, std::span<M> out,
+                       ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+        template <typename M, typename T>
+        void getMember(std::span<T *const> objects, MemberHandle member, std::span<M> out,
+                       ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+        template <typename M, typename T>
+        void setMember(std::span<T> objects, MemberHandle member, std::span<const M> values,
+                       ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+        template <typename M, typename T>
+        void setMember(std::span<T *const> objects, MemberHandle member, std::span<const M> values,
+                       ThreadPool *pool = nullptr, std::size_t min_chunk = default_chunk);
+    }
+
+}
+
+#include "inline/batch.hxx"
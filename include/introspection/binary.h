@@ -0,0 +1,99 @@
+#pragma once
+#include <introspection/allocator.h>
+#include <introspection/catalog.h>
+#include <introspection/introspectable.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Compact binary archive of introspectable objects.
+     *
+     * Layout (native byte order):
+     * - header: the 4 bytes "IBA1",
+     * - per object: a u32 type reference, then each member in registration
+     *   order. The first object of a type uses the reference 0xffffffff,
+     *   followed by the class name (u32 length + bytes) and the schema hash
+     *   (u64, see TypeInfo::schemaHash()); later objects of that type use its
+     *   index in order of appearance.
+     * - members: trivially copyable members (int, float, Vector3D, ...) are
+     *   their raw bytes, other types use their codec binary encoding (strings
+     *   and vectors are a u32 length followed by the data).
+     *
+     * Members are walked through the TypeInfo tables: no name lookup and no
+     * std::any. Codecs are resolved once per type.
+     * @example
+     * ```c++
+     * std::string buffer;
+     * BinaryWriter writer(buffer);
+     * writer.write(player);
+     *
+     * BinaryReader reader(buffer);
+     * GameObject copy;
+     * reader.read(copy);
+     * ```
+     */
+    class BinaryWriter
+    {
+    public:
+        explicit BinaryWriter(std::string &buffer);
+
+        void write(const Introspectable &object);
+
+    private:
+        struct TypeRecord
+        {
+            const TypeInfo *type;
+            std::vector<const ValueCodec *> codecs; // nullptr for raw copies
+        };
+
+        std::string &out;
+        std::vector<TypeRecord> types;
+    };
+
+    /**
+     * @brief Reads back a BinaryWriter archive. Throws std::runtime_error on a
+     * truncated archive or when the schema of the stored type differs from the
+     * one of the target object.
+     */
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(std::string_view data);
+
+        void read(Introspectable &object);
+
+        /**
+         * @brief Construct the next object, of the class stored in the
+         * archive, in storage from `allocator` and read it. The class is looked
+         * up by name in the TypeCatalog (see REGISTER_INTROSPECTABLE) and must
+         * be default constructible.
+         */
+        ObjectHandle readObject(ObjectAllocator &allocator = HeapAllocator::instance());
+
+        bool atEnd() const { return in.empty(); }
+
+    private:
+        struct TypeRecord
+        {
+            std::string class_name;
+            std::uint64_t schema_hash;
+            const TypeInfo *type = nullptr; // Bound on first read
+            std::vector<const ValueCodec *> codecs;
+        };
+
+        TypeRecord &readTypeRecord();
+        void bind(TypeRecord &record, const TypeInfo &type_info);
+        void readMembers(const TypeRecord &record, void *object, ChangeSet *changes);
+
+        std::string_view in;
+        std::vector<TypeRecord> types;
+    };
+
+}
+
+#include "inline/binary.hxx"
@@ -0,0 +1,96 @@
+#pragma once
+#include <introspection/info.h>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace introspection
+{
+
+    /**
+     * @brief Bulk kernels over one numeric member of many objects.
+     *
+     * gather() / scatter() move a member between objects (a contiguous array,
+     * or a span of pointers) and a packed buffer; the member is resolved once
+     * through the TypeInfo of the class, then read at a fixed offset. The
+     * reductions and transforms work on any contiguous range of numbers: a
+     * gathered buffer, a std::vector or a SoAVector column. With AVX2 enabled
+     * (-mavx2, see the INTROSPECTION_ENABLE_AVX2 CMake option), the float,
+     * double and int kernels process 8 (4 for double) values per instruction;
+     * otherwise they are plain loops. Floating-point sums are accumulated in
+     * several lanes, so their rounding may differ from a sequential loop.
+     * Integer sums are accumulated and returned in 64 bits (SumOf), and only
+     * wrap, modulo 2^64, past that range. min() and max() return NaN as soon
+     * as the range holds one, with or without AVX2.
+     * @example
+     * ```c++
+     * auto health = GameObject::getStaticTypeInfo().findMember("health");
+     * std::vector<float> values(objects.size());
+     * bulk::gather<float>(std::span<const GameObject>(objects), health, values);
+     * bulk::scale(values, 0.5f);
+     * bulk::scatter<float>(values, std::span<GameObject>(objects), health);
+     *
+     * float total = bulk::sum(population.column<float>("health"));
+     * ```
+     */
+    namespace bulk
+    {
+        template <typename R>
+        concept NumericRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                               std::is_arithmetic_v<std::ranges::range_value_t<R>>;
+
+        template <typename R>
+        concept MutableNumericRange = NumericRange<R> &&
+                                      !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+        template <typename R>
+        using ValueOf = std::ranges::range_value_t<R>;
+
+        // Result of sum(): the value type for floating point, 64-bit integers otherwise
+        template <typename M>
+        using SumType = std::conditional_t<std::is_floating_point_v<M>, M,
+                                           std::conditional_t<std::is_signed_v<M>, std::int64_t, std::uint64_t>>;
+        template <typename R>
+        using SumOf = SumType<ValueOf<R>>;
+
+        /**
+         * @brief Copy `member` of each object into `out` (out.size() must be
+         * objects.size()). Throws std::runtime_error if the member is not
+         * exactly of type M.
+         */
+        template <typename M, typename T>
+        void gather(std::span<const T> objects, MemberHandle member, std::span<M> out);
+        template <typename M, typename T>
+        void gather(std::span<T *const> objects, MemberHandle member, std::span<M> out);
+
+        // Reverse of gather(): assign `values[i]` to `member` of each object
+        template <typename M, typename T>
+        void scatter(std::span<const M> values, std::span<T> objects, MemberHandle member);
+        template <typename M, typename T>
+        void scatter(std::span<const M> values, std::span<T *const> objects, MemberHandle member);
+
+        template <NumericRange R>
+        SumOf<R> sum(const R &values);
+
+        // Throw std::runtime_error on an empty range; NaN if any value is NaN
+        template <NumericRange R>
+        ValueOf<R> min(const R &values);
+        template <NumericRange R>
+        ValueOf<R> max(const R &values);
+
+        // values[i] *= factor
+        template <MutableNumericRange R>
+        void scale(R &&values, ValueOf<R> factor);
+
+        // y[i] += a * x[i]; throws std::runtime_error if the sizes differ
+        template <NumericRange X, MutableNumericRange Y>
+            requires std::same_as<ValueOf<X>, ValueOf<Y>>
+        void axpy(ValueOf<Y> a, const X &x, Y &&y);
+    }
+
+}
+
+#include "inline/bulk.hxx"
@@ -0,0 +1,138 @@
+#pragma once
+#include <introspection/introspectable.h>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Cost of building the TypeInfo of the catalog types. Types that
+     * were already built on first use, before initializeAll() reached them,
+     * are only counted in `already_built`.
+     */
+    struct TypeCatalogStats
+    {
+        std::size_t types = 0;
+        std::size_t members = 0;
+        std::size_t methods = 0;
+        std::size_t bytes = 0;                 // Sum of TypeInfo::memoryFootprint()
+        std::chrono::nanoseconds duration{0}; // Time spent building them
+        std::size_t already_built = 0;
+    };
+
+    /**
+     * @brief Global catalog of the introspectable classes declared with
+     * REGISTER_INTROSPECTABLE. Entries are added at static-initialization
+     * time, but a TypeInfo is only built on the first lookup of its class, on
+     * its first getStaticTypeInfo() call, or by initializeAll(). Calling
+     * initializeAll() at start-up moves the whole registration cost out of the
+     * first request, and measures it.
+     *
+     * Lookups by name or TypeId are thread-safe.
+     * @example
+     * ```c++
+     * REGISTER_INTROSPECTABLE(Person);
+     *
+     * int main()
+     * {
+     *     auto stats = introspection::initializeAll();
+     *     std::cout << stats.types << " types, " << stats.bytes << " bytes\n";
+     *     const TypeInfo *person = TypeCatalog::instance().find("Person");
+     * }
+     * ```
+     */
+    class TypeCatalog
+    {
+    public:
+        struct Entry
+        {
+            std::string name;
+            TypeId type_id;
+            TypeInfo &(*type_info)(); // The class getStaticTypeInfo()
+            bool initialized = false;   // Reached by initializeAll()
+            bool already_built = false; // Built on first use before that
+            std::size_t bytes = 0;
+            std::chrono::nanoseconds duration{0}; // TypeInfo::build_duration
+        };
+
+        static TypeCatalog &instance();
+
+        /**
+         * @brief Add an introspectable class under `name`. Adding a class twice
+         * is a no-op; throws std::runtime_error if `name` is already used by
+         * another class.
+         */
+        template <typename T>
+        void add(const std::string &name);
+
+        // nullptr if the class is not in the catalog. Builds its TypeInfo if needed
+        const TypeInfo *find(std::string_view name) const;
+        const TypeInfo *find(TypeId type_id) const;
+
+        std::vector<std::string> names() const; // In order of addition
+        std::size_t size() const;
+        std::vector<Entry> entries() const;
+
+        /**
+         * @brief Build the TypeInfo of every class not yet built by a previous
+         * call, and return the cost of this call. Classes whose TypeInfo was
+         * already built on first use are reported in `already_built` only.
+         */
+        TypeCatalogStats initializeAll();
+
+        // Accumulated cost of all initializeAll() calls
+        TypeCatalogStats stats() const;
+
+        /**
+         * @brief TypeInfo::stats() of every class, in order of addition, and
+         * their JSON dump: an array of TypeStats::writeJSON() objects.
+         */
+        std::vector<TypeStats> callStats() const;
+        JsonWriter &writeCallStats(JsonWriter &out) const;
+
+    private:
+        TypeCatalog() = default;
+
+        std::vector<Entry> catalog;
+        std::map<std::string, std::size_t, std::less<>> by_name;
+        std::unordered_map<TypeId, std::size_t> by_id;
+        mutable std::shared_mutex mutex;
+    };
+
+    /**
+     * @brief Build every TypeInfo of the catalog, see TypeCatalog::initializeAll()
+     */
+    TypeCatalogStats initializeAll();
+
+}
+
+/**
+ * @brief Add an introspectable class to the TypeCatalog and register its type
+ * name, so that it can be built eagerly by introspection::initializeAll() and
+ * looked up by name or type id.
+ *
+ * Usage: REGISTER_INTROSPECTABLE(Person);
+ * This should be called at global scope.
+ */
+#define REGISTER_INTROSPECTABLE(ClassName)                                                        \
+    namespace                                                                                     \
+    {                                                                                             \
+        struct ClassName##_CatalogRegistrar                                                       \
+        {                                                                                         \
+            ClassName##_CatalogRegistrar()                                                        \
+            {                                                                                     \
+                introspection::TypeNameRegistry::instance().register_type<ClassName>(#ClassName); \
+                introspection::TypeCatalog::instance().add<ClassName>(#ClassName);                \
+            }                                                                                     \
+        };                                                                                        \
+        static ClassName##_CatalogRegistrar ClassName##_catalog_registrar_instance;               \
+    }
+
+#include "inline/catalog.hxx"
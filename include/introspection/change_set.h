@@ -0,0 +1,226 @@
+#pragma once
+#include <introspection/info.h>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace introspection
+{
+
+    /**
+     * @brief Notified when a member of an observed ChangeSet becomes changed,
+     * i.e. when its bit goes from clear to set: further writes to a member
+     * that was not collected yet do not notify again. markAll() notifies once
+     * with an invalid handle. A listener (ChangeSet::listen()) is told about
+     * every mark instead. Called on the writing thread, so it should only
+     * wake whoever collects the changes.
+     */
+    class ChangeObserver
+    {
+    public:
+        virtual ~ChangeObserver() = default;
+        virtual void memberChanged(MemberHandle member) = 0;
+    };
+
+    /**
+     * @brief Set of the changed members of one object, one bit per member
+     * index (see MemberHandle). Marking is a single atomic OR and consume()
+     * swaps each word with zero, so writers on any thread can keep marking
+     * while a sync thread collects, and no change is lost in between.
+     *
+     * Besides its observer, a set accepts a few listeners, told about every
+     * mark rather than only the first one since the last collection, for
+     * structures that must follow each write without collecting (e.g.
+     * MemberIndex). A set without listeners pays one relaxed load per mark.
+     *
+     * A copy starts clean and unobserved; an assignment marks every member,
+     * since a copy-assigned object may differ in all of them.
+     */
+    class ChangeSet
+    {
+    public:
+        static constexpr std::size_t capacity = 256; // Members per class
+        static constexpr std::size_t max_listeners = 4;
+
+        ChangeSet() = default;
+        ChangeSet(const ChangeSet &) noexcept {}
+        ChangeSet &operator=(const ChangeSet &)
+        {
+            markAll();
+            return *this;
+        }
+
+        void mark(MemberHandle member)
+        {
+            if (member.index < capacity)
+            {
+                const std::uint64_t bit = std::uint64_t{1} << (member.index % 64);
+                const std::uint64_t previous = words[member.index / 64].fetch_or(bit, std::memory_order_acq_rel);
+                if (!(previous & bit))
+                {
+                    notify(member);
+                }
+                notifyListeners(member);
+            }
+        }
+
+        void markAll()
+        {
+            for (auto &word : words)
+            {
+                word.store(~std::uint64_t{0}, std::memory_order_release);
+            }
+            notify(MemberHandle{});
+            notifyListeners(MemberHandle{});
+        }
+
+        /**
+         * @brief Attach an observer (nullptr detaches it). It must outlive
+         * the marks that may reach it: detach it before destroying it.
+         */
+        void observe(ChangeObserver *new_observer) noexcept
+        {
+            observer.store(new_observer, std::memory_order_release);
+        }
+
+        /**
+         * @brief Attach a listener to every mark; false if all the slots are
+         * taken. unlisten() returns once no writer can still be calling the
+         * listener, which may then be destroyed; it must not be called from
+         * a listener of the same set.
+         */
+        bool listen(ChangeObserver *listener) noexcept
+        {
+            for (auto &slot : listeners)
+            {
+                ChangeObserver *expected = nullptr;
+                if (slot.compare_exchange_strong(expected, listener, std::memory_order_acq_rel))
+                {
+                    listener_count.fetch_add(1, std::memory_order_release);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void unlisten(ChangeObserver *listener) noexcept
+        {
+            for (auto &slot : listeners)
+            {
+                ChangeObserver *expected = listener;
+                if (slot.compare_exchange_strong(expected, nullptr, std::memory_order_seq_cst))
+                {
+                    listener_count.fetch_sub(1, std::memory_order_release);
+                    quiesce();
+                    return;
+                }
+            }
+        }
+
+        bool test(MemberHandle member) const noexcept
+        {
+            return member.index < capacity &&
+                   (words[member.index / 64].load(std::memory_order_acquire) >> (member.index % 64)) & 1;
+        }
+
+        bool any() const noexcept
+        {
+            for (const auto &word : words)
+            {
+                if (word.load(std::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void clear() noexcept
+        {
+            for (auto &word : words)
+            {
+                word.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Clear the set and call visit(MemberHandle) for each member
+         * that was marked, in index order. Bits at or past `member_count`
+         * (left by markAll()) are dropped.
+         */
+        template <typename F>
+        void consume(std::size_t member_count, F &&visit)
+        {
+            for (std::size_t w = 0; w < words.size() && w * 64 < member_count; ++w)
+            {
+                std::uint64_t bits = words[w].exchange(0, std::memory_order_acq_rel);
+                while (bits)
+                {
+                    const std::size_t index = w * 64 + std::countr_zero(bits);
+                    bits &= bits - 1;
+                    if (index >= member_count)
+                    {
+                        break;
+                    }
+                    visit(MemberHandle{static_cast<std::uint32_t>(index)});
+                }
+            }
+            for (std::size_t w = (member_count + 63) / 64; w < words.size(); ++w)
+            {
+                words[w].store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        void notify(MemberHandle member)
+        {
+            if (auto *current = observer.load(std::memory_order_acquire))
+            {
+                current->memberChanged(member);
+            }
+        }
+
+        void notifyListeners(MemberHandle member)
+        {
+            if (listener_count.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+            // Announced in the current epoch before any slot is read, so
+            // that unlisten() can wait for it
+            auto &active = notifying[epoch.load(std::memory_order_seq_cst) & 1];
+            active.fetch_add(1, std::memory_order_seq_cst);
+            for (auto &slot : listeners)
+            {
+                if (auto *current = slot.load(std::memory_order_seq_cst))
+                {
+                    current->memberChanged(member);
+                }
+            }
+            active.fetch_sub(1, std::memory_order_release);
+        }
+
+        // Wait for the writers that may have loaded a removed listener.
+        // Writers starting after the flip count in the other epoch, so they
+        // do not delay the wait (unless another unlisten() flips it back)
+        void quiesce() noexcept
+        {
+            const std::uint32_t previous = epoch.fetch_add(1, std::memory_order_seq_cst);
+            while (notifying[previous & 1].load(std::memory_order_seq_cst) != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        std::array<std::atomic<std::uint64_t>, capacity / 64> words{};
+        std::atomic<ChangeObserver *> observer{nullptr};
+        std::array<std::atomic<ChangeObserver *>, max_listeners> listeners{};
+        std::atomic<std::uint32_t> listener_count{0};
+        std::atomic<std::uint32_t> epoch{0};
+        std::array<std::atomic<std::uint32_t>, 2> notifying{}; // Writers in listeners, by epoch parity
+    };
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <introspection/change_set.h>
+#include <introspection/introspectable.h>
+#include <string_view>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Opt-in change tracking: an Introspectable that records which
+     * members were assigned since the last collectChanges(), so a sync loop
+     * only encodes and sends what changed.
+     *
+     * Every write through the introspection API marks its member (the
+     * registered setters used by setMemberValue(), setMember(), setMembers(),
+     * fromJSON(), batch updates and BinaryReader). Code writing a member
+     * directly, including method bodies, calls markChanged() itself; writes
+     * through a non-const getMemberRef() or raw bulk kernels are not seen.
+     * Marking and collecting are lock-free and can run on different threads;
+     * a ChangeObserver attached to changeSet() is told when to collect.
+     * @example
+     * ```c++
+     * class Player : public introspection::ChangeTracked
+     * {
+     *     INTROSPECTABLE(Player)
+     *     ...
+     *     void heal() { health = 100; markChanged("health"); }
+     * };
+     *
+     * player.setMemberValue("name", std::string("Hero"));
+     * for (MemberHandle member : player.collectChanges())
+     *     send(player.getTypeInfo().memberAt(member).name);   // "name" only
+     * ```
+     */
+    class ChangeTracked : public Introspectable
+    {
+    public:
+        ChangeSet *changeSet() override { return &changes; }
+        ChangeSet &trackedChanges() { return changes; }
+
+        using Introspectable::markChanged;
+        void markChanged(std::string_view member);
+        void markAllChanged() { changes.markAll(); }
+
+        bool hasChanges() const { return changes.any(); }
+        bool isChanged(MemberHandle member) const { return changes.test(member); }
+        bool isChanged(std::string_view member) const;
+
+        /**
+         * @brief Handles of the members changed since the last call, in
+         * registration order, and clear them. The visitor form, called with
+         * each MemberHandle, does not allocate.
+         */
+        std::vector<MemberHandle> collectChanges();
+        template <typename F>
+        void collectChanges(F &&visit);
+        void clearChanges() { changes.clear(); }
+
+    private:
+        ChangeSet changes;
+    };
+
+}
+
+#include "inline/change_tracked.hxx"
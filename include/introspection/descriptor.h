@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace introspection
+{
+
+    /**
+     * @brief Compile-time description of one member: its name and member
+     * pointer. Built with field() inside a constexpr `staticFields()` function.
+     */
+    template <typename Class, typename Member>
+    struct Field
+    {
+        using class_type = Class;
+        using value_type = Member;
+
+        std::string_view name;
+        Member Class::*pointer;
+
+        constexpr const Member &get(const Class &object) const { return object.*pointer; }
+        constexpr Member &get(Class &object) const { return object.*pointer; }
+    };
+
+    template <typename Class, typename Member>
+    constexpr Field<Class, Member> field(std::string_view name, Member Class::*pointer);
+
+    // Tuple of Field, the static descriptor of a class
+    template <typename... Fields>
+    constexpr std::tuple<Fields...> describe(Fields... fields);
+
+    /**
+     * @brief A class with a static descriptor: a public
+     * `static constexpr auto staticFields()` returning describe(field(...), ...).
+     * @example
+     * ```c++
+     * class Person : public introspection::Introspectable
+     * {
+     *     INTROSPECTABLE(Person)
+     * public:
+     *     static constexpr auto staticFields()
+     *     {
+     *         using introspection::field;
+     *         return introspection::describe(field("name", &Person::name),
+     *                                        field("age", &Person::age));
+     *     }
+     *     ...
+     * };
+     *
+     * void Person::registerIntrospection(introspection::TypeRegistrar<Person> reg)
+     * {
+     *     reg.fields(staticFields()) // Runtime members generated from the descriptor
+     *         .method("introduce", &Person::introduce);
+     * }
+     * ```
+     */
+    template <typename T>
+    concept StaticallyDescribed = requires { std::tuple_size<decltype(T::staticFields())>::value; };
+
+    template <StaticallyDescribed T>
+    inline constexpr std::size_t static_member_count = std::tuple_size_v<decltype(T::staticFields())>;
+
+    /**
+     * @brief Call `visitor(name, value)` for each member of the static
+     * descriptor of T, in declaration order. `name` is a std::string_view
+     * literal and `value` a reference to the member (const if `object` is),
+     * so the loop is unrolled at compile time into direct member accesses:
+     * no TypeInfo, std::any or virtual call is involved.
+     * ```c++
+     * for_each_member(person, [](std::string_view name, const auto &value) { ... });
+     * ```
+     */
+    template <typename T, typename Visitor>
+        requires StaticallyDescribed<std::remove_const_t<T>>
+    constexpr void for_each_member(T &object, Visitor &&visitor);
+
+    /**
+     * @brief Call `visitor(field)` for each Field of the static descriptor of
+     * T, without an object (e.g. to generate a schema).
+     */
+    template <StaticallyDescribed T, typename Visitor>
+    constexpr void for_each_field(Visitor &&visitor);
+
+}
+
+#include "inline/descriptor.hxx"
@@ -1,9 +1,24 @@
 #pragma once
+#include <introspection/perfect_hash.h>
+#include <introspection/stats.h>
+#include <introspection/thunk.h>
+#include <introspection/type_id.h>
+#include <introspection/value_codec.h>
 #include <any>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <new>
+#include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 namespace introspection
@@ -12,38 +27,324 @@ namespace introspection
     using Arg = std::any;
     using Args = std::vector<Arg>;
 
+    /**
+     * @brief Non-owning view of one call argument: a pointer to the caller's
+     * value, its exact type and what the callee may do with it. Frames of
+     * ArgView live on the caller's stack, so invoking through them allocates
+     * nothing.
+     *
+     * of(const T &) only binds to const references and by-value parameters.
+     * of(T &) also binds non-const reference parameters, written through to
+     * the caller's value, and copies into rvalue reference parameters.
+     * movable(T &) hands the value over: by-value and rvalue reference
+     * parameters move from it. Any other binding throws the argument type
+     * mismatch error.
+     */
+    struct ArgView
+    {
+        enum class Access : std::uint8_t
+        {
+            Read,  // A const value
+            Write, // A modifiable lvalue
+            Move   // An rvalue, the callee may move from it
+        };
+
+        const void *data = nullptr;
+        TypeId type = 0;
+        Access access = Access::Read;
+
+        template <typename T>
+        static ArgView of(const T &value) { return ArgView{&value, typeId<T>(), Access::Read}; }
+        template <typename T>
+            requires(!std::is_const_v<T>)
+        static ArgView of(T &value) { return ArgView{&value, typeId<T>(), Access::Write}; }
+        template <typename T>
+            requires(!std::is_const_v<T>)
+        static ArgView movable(T &value) { return ArgView{&value, typeId<T>(), Access::Move}; }
+    };
+
+    /**
+     * @brief Caller-provided storage receiving the return value of a frame
+     * invocation. The storage must hold an object of exactly the method's
+     * return type, which gets assigned. An empty slot discards the result.
+     */
+    struct ReturnSlot
+    {
+        void *data = nullptr;
+        TypeId type = 0;
+
+        template <typename T>
+        static ReturnSlot of(T &storage) { return ReturnSlot{&storage, typeId<T>()}; }
+    };
+
+    using ArgFrame = std::span<const ArgView>;
+
+    using MemberGetter = Thunk<Arg(const void *)>;
+    using MemberSetter = Thunk<void(void *, const Arg &)>;
+    using MemberAddress = Thunk<void *(void *)>;
+    using MethodInvoker = Thunk<Arg(void *, const Args &)>;
+    using FrameInvoker = Thunk<void(void *, ArgFrame, ReturnSlot)>;
+    using ConstructorFactory = Thunk<void *(const Args &)>;
+    using ConstructorEmplacer = Thunk<void(void *, ArgFrame)>;
+
+    /**
+     * @brief Pre-resolved index of a member inside its TypeInfo.
+     * Resolve it once by name with TypeInfo::findMember() (or
+     * Introspectable::getMemberHandle()) and reuse it for O(1) access without
+     * any string hashing. A handle is only meaningful for the TypeInfo it was
+     * resolved from.
+     */
+    struct MemberHandle
+    {
+        static constexpr std::uint32_t invalid_index = ~std::uint32_t{0};
+        std::uint32_t index = invalid_index;
+
+        bool valid() const { return index != invalid_index; }
+        explicit operator bool() const { return valid(); }
+    };
+
+    /**
+     * @brief Pre-resolved index of a method inside its TypeInfo.
+     * @see MemberHandle
+     */
+    struct MethodHandle
+    {
+        static constexpr std::uint32_t invalid_index = ~std::uint32_t{0};
+        std::uint32_t index = invalid_index;
+
+        bool valid() const { return index != invalid_index; }
+        explicit operator bool() const { return valid(); }
+    };
+
     /**
      * @brief Holds information about a constructor.
+     *
+     * factory heap-allocates a new instance from boxed arguments. construct_at
+     * builds the instance in caller-provided storage (suitably sized and
+     * aligned, uninitialized) from a typed ArgFrame, so a bridge can construct
+     * straight into the memory that will own the object. If the constructor
+     * throws, nothing is left constructed at the address.
      */
     class ConstructorInfo
     {
     public:
         std::vector<std::string> parameter_types;
-        std::function<void *(const Args &)> factory; // Creates new instance
+        std::vector<TypeId> parameter_type_ids;
+        ConstructorFactory factory;       // Creates new instance
+        ConstructorEmplacer construct_at; // Constructs at an address
 
         ConstructorInfo(const std::vector<std::string> &param_types,
-                        std::function<void *(const Args &)> fact)
-            : parameter_types(param_types), factory(fact) {}
+                        const std::vector<TypeId> &param_type_ids,
+                        ConstructorFactory fact,
+                        ConstructorEmplacer emplacer)
+            : parameter_types(param_types), parameter_type_ids(param_type_ids), factory(fact),
+              construct_at(emplacer) {}
+
+        // Whether arguments of exactly these types select this constructor
+        bool accepts(std::span<const TypeId> argument_types) const;
+        bool accepts(ArgFrame args) const;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        concept StdHashable = requires(const T &value) {
+            { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+        };
+
+        inline std::size_t hashCombine(std::size_t seed, std::size_t value)
+        {
+            return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+        }
+
+        // std::hash, or the elements of a range (std::vector, std::array) of hashable values
+        template <typename T>
+        constexpr bool hashable()
+        {
+            if constexpr (StdHashable<T>)
+            {
+                return true;
+            }
+            else if constexpr (std::ranges::range<T>)
+            {
+                return hashable<std::remove_cvref_t<std::ranges::range_value_t<T>>>();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template <typename T>
+        std::size_t hashValue(const T &value)
+        {
+            if constexpr (StdHashable<T>)
+            {
+                return std::hash<T>{}(value);
+            }
+            else
+            {
+                std::size_t seed = 0;
+                for (const auto &element : value)
+                {
+                    seed = hashCombine(seed, hashValue(element));
+                }
+                return seed;
+            }
+        }
+    }
+
+    /**
+     * @brief Storage properties of a value type, known at registration. They
+     * let generic code (e.g. the binary archive) copy trivially-copyable
+     * members with a single memcpy, assign any member between two addresses
+     * without boxing it, and compare or hash two values (e.g. for diff() and
+     * hashMembers()). The function pointers are null when the type is not
+     * copy-assignable, has no operator== or no std::hash (directly or for the
+     * elements of a std::vector / std::array).
+     */
+    struct ValueOps
+    {
+        std::uint32_t size = 0;
+        std::uint32_t alignment = 0;
+        bool trivially_copyable = false;
+        void (*copy_assign)(void *dst, const void *src) = nullptr;
+        bool (*equals)(const void *a, const void *b) = nullptr;
+        std::size_t (*hash)(const void *value) = nullptr;
+
+        template <typename T>
+        static constexpr ValueOps of()
+        {
+            ValueOps ops;
+            ops.size = sizeof(T);
+            ops.alignment = alignof(T);
+            ops.trivially_copyable = std::is_trivially_copyable_v<T>;
+            if constexpr (std::is_copy_assignable_v<T>)
+            {
+                ops.copy_assign = [](void *dst, const void *src)
+                { *static_cast<T *>(dst) = *static_cast<const T *>(src); };
+            }
+            if constexpr (std::equality_comparable<T>)
+            {
+                ops.equals = [](const void *a, const void *b)
+                { return *static_cast<const T *>(a) == *static_cast<const T *>(b); };
+            }
+            if constexpr (detail::hashable<T>())
+            {
+                ops.hash = [](const void *value)
+                { return detail::hashValue(*static_cast<const T *>(value)); };
+            }
+            return ops;
+        }
+    };
+
+    class Introspectable;
+
+    /**
+     * @brief Layout and lifetime of a registered class, filled in by
+     * TypeRegistrar. They let an ObjectAllocator place objects of a type it
+     * only knows through its TypeInfo, an ObjectHandle destroy them, and
+     * clone() copy them. `construct` (default construction at an address),
+     * `copy_construct` and `copy_assign` are null when the class lacks the
+     * matching operation; `introspectable` and `instance` (the casts between
+     * the class and its Introspectable base) are null when the class does not
+     * derive from Introspectable.
+     */
+    struct ObjectOps
+    {
+        std::uint32_t size = 0;
+        std::uint32_t alignment = 0;
+        void (*construct)(void *address) = nullptr;
+        void (*copy_construct)(void *address, const void *source) = nullptr;
+        void (*copy_assign)(void *target, const void *source) = nullptr;
+        void (*destroy)(void *object) = nullptr;
+        Introspectable *(*introspectable)(void *object) = nullptr;
+        void *(*instance)(Introspectable *object) = nullptr;
+
+        template <typename T>
+        static constexpr ObjectOps of()
+        {
+            ObjectOps ops;
+            ops.size = sizeof(T);
+            ops.alignment = alignof(T);
+            if constexpr (std::is_default_constructible_v<T>)
+            {
+                ops.construct = [](void *address)
+                { ::new (address) T(); };
+            }
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                ops.copy_construct = [](void *address, const void *source)
+                { ::new (address) T(*static_cast<const T *>(source)); };
+            }
+            if constexpr (std::is_copy_assignable_v<T>)
+            {
+                ops.copy_assign = [](void *target, const void *source)
+                { *static_cast<T *>(target) = *static_cast<const T *>(source); };
+            }
+            ops.destroy = [](void *object)
+            { static_cast<T *>(object)->~T(); };
+            if constexpr (std::is_base_of_v<Introspectable, T>)
+            {
+                ops.introspectable = [](void *object) -> Introspectable *
+                { return static_cast<T *>(object); };
+                ops.instance = [](Introspectable *object) -> void *
+                { return static_cast<T *>(object); };
+            }
+            return ops;
+        }
     };
 
     /**
      * @brief Holds information about a member variable.
+     * Besides the std::any based getter/setter, `address` gives a raw pointer
+     * to the member inside an object, guarded by the exact member type. This
+     * is the allocation-free path used by Introspectable::getMemberRef() and
+     * Introspectable::setMember(). `type_name` is for display; dispatch on
+     * `type_id`. `stats_slot` and the next one count its reads and writes
+     * (see TypeInfo::stats()) once TypeInfo::assignStatsSlots() gave them
+     * out. The codec of the member type is resolved
+     * when the member is registered.
      */
     class MemberInfo
     {
     public:
         std::string name;
         std::string type_name;
-        std::function<Arg(const void *)> getter;
-        std::function<void(void *, const Arg &)> setter;
+        TypeId type_id;
+        std::type_index type;
+        MemberGetter getter;
+        MemberSetter setter;
+        MemberAddress address;
+        ValueOps ops;
+        std::uint32_t stats_slot = detail::no_stats_slot;
 
-        MemberInfo(const std::string &n, const std::string &t,
-                   std::function<Arg(const void *)> g,
-                   std::function<void(void *, const Arg &)> s);
+        MemberInfo(const std::string &n, const std::string &t, TypeId id, std::type_index ti,
+                   MemberGetter g, MemberSetter s, MemberAddress a, ValueOps o = {});
+
+        /**
+         * @brief Check whether the member is exactly of type T (a single
+         * integer comparison).
+         */
+        template <typename T>
+        bool holds() const { return type_id == typeId<T>(); }
+
+        /**
+         * @brief Codec of the member type, or nullptr if the type has none
+         * registered in the ValueCodecRegistry. No registry lookup happens
+         * when the codec was already registered along with the member.
+         */
+        const ValueCodec *codec() const;
+
+    private:
+        const ValueCodec *resolved_codec;
     };
 
     /**
      * @brief Holds information about a method.
+     * `invoker` takes boxed std::any arguments, while `frame_invoker` takes an
+     * ArgFrame and forwards each argument by reference into the method. Type
+     * names are for display; dispatch on the type ids.
      */
     class MethodInfo
     {
@@ -51,28 +352,39 @@ namespace introspection
         std::string name;
         std::string return_type;
         std::vector<std::string> parameter_types;
-        std::function<Arg(void *, const Args &)> invoker;
+        TypeId return_type_id;
+        std::vector<TypeId> parameter_type_ids;
+        MethodInvoker invoker;
+        FrameInvoker frame_invoker;
+        std::uint32_t stats_slot = detail::no_stats_slot;
 
         MethodInfo(const std::string &n, const std::string &ret_type,
                    const std::vector<std::string> &param_types,
-                   std::function<Arg(void *, const Args &)> inv);
+                   TypeId ret_type_id, const std::vector<TypeId> &param_type_ids,
+                   MethodInvoker inv, FrameInvoker frame_inv);
     };
 
     /**
      * @brief Holds information about a class type, including its members and
-     * methods. Uses unique_ptr to manage MemberInfo and MethodInfo instances. Copy
-     * operations are deleted to prevent copying of unique_ptrs. Move operations are
-     * defaulted to allow moving of TypeInfo instances. This design ensures proper
-     * resource management and avoids memory leaks. C++20 standard is used for
-     * std::any and other features.
+     * methods. Members and methods are stored contiguously in registration
+     * order, so they can be addressed by index through MemberHandle and
+     * MethodHandle; the name indexes are only used to resolve handles. Copy
+     * operations are deleted to prevent copying of the constructor unique_ptrs.
+     * Move operations are defaulted to allow moving of TypeInfo instances.
+     * C++20 standard is used for std::any and other features.
      */
     class TypeInfo
     {
     public:
         std::string class_name;
-        std::unordered_map<std::string, std::unique_ptr<MemberInfo>> members;
-        std::unordered_map<std::string, std::unique_ptr<MethodInfo>> methods;
+        std::vector<MemberInfo> members; // In registration order
+        std::vector<MethodInfo> methods; // In registration order
         std::vector<std::unique_ptr<ConstructorInfo>> constructors;
+        ObjectOps object; // Size, alignment and destructor of the class
+
+        // When registration finished and how long it took (set by INTROSPECTABLE)
+        std::chrono::steady_clock::time_point built_at{};
+        std::chrono::nanoseconds build_duration{0};
 
         explicit TypeInfo(const std::string &name) : class_name(name) {}
 
@@ -84,16 +396,91 @@ namespace introspection
         TypeInfo(TypeInfo &&) = default;
         TypeInfo &operator=(TypeInfo &&) = default;
 
-        void addMember(std::unique_ptr<MemberInfo> member);
-        void addMethod(std::unique_ptr<MethodInfo> method);
+        /**
+         * @brief Add a member or a method and return its handle. Registering
+         * an already known name replaces the previous entry in place, keeping
+         * its handle.
+         */
+        MemberHandle addMember(MemberInfo member);
+        MethodHandle addMethod(MethodInfo method);
         void addConstructor(std::unique_ptr<ConstructorInfo> ctor);
 
-        const MemberInfo *getMember(const std::string &name) const;
-        const MethodInfo *getMethod(const std::string &name) const;
+        /**
+         * @brief Build the perfect-hash name indexes once registration is
+         * over (INTROSPECTABLE does it after registerIntrospection()). Names
+         * added since the last call are still found, through a plain hash map.
+         */
+        void finalize();
+
+        /**
+         * @brief Give the members and methods that have none their stats
+         * counters (see stats()). INTROSPECTABLE does it once per class; a
+         * TypeInfo built by hand and never given slots is not counted, so
+         * temporary ones use no counter memory.
+         */
+        void assignStatsSlots();
+
+        const MemberInfo *getMember(std::string_view name) const;
+        const MethodInfo *getMethod(std::string_view name) const;
         const std::vector<std::unique_ptr<ConstructorInfo>> &getConstructors() const;
 
+        /**
+         * @brief Overload resolution: the first constructor, in registration
+         * order, whose parameter types are exactly `argument_types` (or the
+         * types of the frame). Returns nullptr if there is none.
+         */
+        const ConstructorInfo *findConstructor(std::span<const TypeId> argument_types) const;
+        const ConstructorInfo *findConstructor(ArgFrame args) const;
+
+        /**
+         * @brief Resolve a handle by name. Returns an invalid handle if the name
+         * is unknown.
+         */
+        MemberHandle findMember(std::string_view name) const;
+        MethodHandle findMethod(std::string_view name) const;
+
+        /**
+         * @brief O(1) access by handle. Throws std::runtime_error if the handle
+         * is invalid for this type.
+         */
+        const MemberInfo &memberAt(MemberHandle handle) const;
+        const MethodInfo &methodAt(MethodHandle handle) const;
+
         std::vector<std::string> getMemberNames() const;
         std::vector<std::string> getMethodNames() const;
+
+        /**
+         * @brief Approximate number of bytes owned by this TypeInfo (tables,
+         * strings beyond the small-string buffer and name indexes).
+         */
+        std::size_t memoryFootprint() const;
+
+        /**
+         * @brief Hash of the class name and of the name, type name and size of
+         * each member in registration order. Two builds agree on it when they
+         * agree on the layout of the serialized data.
+         */
+        std::uint64_t schemaHash() const;
+
+        /**
+         * @brief Call counters and latency histograms of the members and
+         * methods, summed over all threads. They are only recorded when the
+         * library is built with INTROSPECTION_ENABLE_STATS; otherwise the
+         * dispatch path carries no instrumentation and every count is zero.
+         */
+        TypeStats stats() const;
+
+    private:
+        std::uint32_t memberIndexOf(std::string_view name) const;
+        std::uint32_t methodIndexOf(std::string_view name) const;
+
+        // Name lookups, built by finalize()
+        PerfectHashIndex member_index;
+        PerfectHashIndex method_index;
+
+        // Name hash -> index of the entries added since finalize()
+        std::unordered_multimap<std::uint64_t, std::uint32_t> pending_members;
+        std::unordered_multimap<std::uint64_t, std::uint32_t> pending_methods;
     };
 
 }
@@ -1,9 +1,55 @@
 #include <introspection/introspectable.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <new>
 
 using namespace introspection;
 
+/**
+ * @brief JS conversion of one C++ type, resolved once per member and method
+ * parameter when a class is bound, so a call does no lookup by type name.
+ * Built-in types convert directly between a Napi::Value and the C++ value in
+ * place; other types go through their ValueCodec; types given a converter
+ * with register_type_converter() go through std::any.
+ */
+struct JsConverter
+{
+    TypeId type_id = 0;
+    std::string type_name;
+    const ValueCodec *codec = nullptr; // Storage (emplace / unbox) and codec conversions
+
+    // C++ value -> JS, and JS -> existing C++ value (false if it does not convert)
+    Napi::Value (*to_js)(Napi::Env, const void *value, const JsConverter &self) = nullptr;
+    bool (*from_js)(const Napi::Value &js_value, void *value, const JsConverter &self) = nullptr;
+
+    // Converters registered by type name, taking precedence
+    const CppToJsConverter *boxed_to_js = nullptr;
+    const JsToCppConverter *boxed_to_cpp = nullptr;
+
+    // Built-in type converted in place, straight into the member storage
+    bool direct = false;
+
+    bool isVoid() const { return type_id == typeId<void>(); }
+    // Whether values can live in a std::any built by the codec (frame calls)
+    bool framed() const { return isVoid() || (codec && !boxed_to_js && !boxed_to_cpp && from_js); }
+
+    Napi::Value toJs(Napi::Env env, const std::any &value) const;
+    std::any toCpp(const Napi::Value &js_value) const;
+    // Convert into the value at `value`, throwing a TypeError if it does not convert
+    void assign(const Napi::Value &js_value, void *value) const;
+};
+
 /**
  * @brief Simple wrapper using Napi::ObjectWrap properly
+ *
+ * Accessors and methods are installed once per class on the prototype,
+ * from the TypeInfo. Each one carries the index of its member or method as
+ * callback data, so a call dispatches without any name lookup and
+ * constructing an instance creates no function. The converters of the
+ * members, parameters and return values are resolved at the same time.
  */
 template <typename T>
 class ObjectWrapper : public Napi::ObjectWrap<ObjectWrapper<T>>
@@ -17,12 +63,51 @@ public:
     T *GetCppObject();
 
 private:
+    using PropertyDescriptor = Napi::ClassPropertyDescriptor<ObjectWrapper<T>>;
+
+    // Pre-resolved conversions of a method or constructor signature
+    struct Signature
+    {
+        std::vector<JsConverter> parameters;
+        JsConverter result;
+        bool framed = false; // Callable through invoke() without boxing
+    };
+
+    static std::vector<JsConverter> member_converters; // By member index
+    static std::vector<Signature> method_signatures;   // By method index
+    static std::vector<Signature> constructor_signatures;
+
     std::shared_ptr<T> cpp_obj;
 
-    void SetupBindings();
-    void SetupProperty(const std::string &prop_name);
-    void SetupMethod(const std::string &method_name);
-    void SetupIntrospection();
+    static void ResolveConverters();
+    // Construct cpp_obj with `ctor`, false if the arguments do not convert
+    bool Construct(const Napi::CallbackInfo &info, const ConstructorInfo &ctor, const Signature &signature);
+    static std::vector<PropertyDescriptor> ClassProperties(std::deque<std::string> &names);
+    static std::uint32_t IndexOf(const Napi::CallbackInfo &info);
+
+    // Dispatch through the index in the callback data
+    Napi::Value GetMember(const Napi::CallbackInfo &info);
+    void SetMember(const Napi::CallbackInfo &info, const Napi::Value &value);
+    Napi::Value SetMemberMethod(const Napi::CallbackInfo &info);
+    Napi::Value CallMethodAt(const Napi::CallbackInfo &info);
+
+    Napi::Value ReadMember(Napi::Env env, MemberHandle handle);
+    void WriteMember(MemberHandle handle, const Napi::Value &value);
+
+    // Introspection API
+    Napi::Value GetClassName(const Napi::CallbackInfo &info);
+    Napi::Value GetMemberNames(const Napi::CallbackInfo &info);
+    Napi::Value GetMethodNames(const Napi::CallbackInfo &info);
+    Napi::Value HasMember(const Napi::CallbackInfo &info);
+    Napi::Value HasMethod(const Napi::CallbackInfo &info);
+    Napi::Value ToJSON(const Napi::CallbackInfo &info);
+    Napi::Value GetMemberValue(const Napi::CallbackInfo &info);
+    Napi::Value SetMemberValue(const Napi::CallbackInfo &info);
+    Napi::Value SetMembers(const Napi::CallbackInfo &info);
+    Napi::Value GetMembers(const Napi::CallbackInfo &info);
+    Napi::Value GetMemberView(const Napi::CallbackInfo &info);
+    Napi::Value CallMethod(const Napi::CallbackInfo &info);
+
     static bool IsSimpleGetterSetter(const std::string &, const TypeInfo &);
     static std::string Capitalize(const std::string &str);
 };
@@ -39,28 +124,244 @@ public:
 
     void register_converter(const std::string &, CppToJsConverter,
                             JsToCppConverter);
-    Napi::Value convert_to_js(Napi::Env, const std::any &,
+    Napi::Value convert_to_js(Napi::Env, const std::any &, TypeId,
                               const std::string &) const;
-    std::any convert_to_cpp(const Napi::Value &, const std::string &) const;
+    std::any convert_to_cpp(const Napi::Value &, TypeId,
+                            const std::string &) const;
+
+    // Resolve the conversion of a type once, for repeated use. Converters
+    // registered later are not seen by it.
+    JsConverter resolve(TypeId, const std::string &) const;
 
 private:
-    TypeConverterRegistry();
+    TypeConverterRegistry() = default;
     std::unordered_map<std::string, CppToJsConverter> cpp_to_js_converters;
     std::unordered_map<std::string, JsToCppConverter> js_to_cpp_converters;
 };
 
 // ------------------------------------------------
 
+namespace introspection::detail
+{
+    template <typename T>
+    inline Napi::Value vectorToJs(Napi::Env env, const std::any &value)
+    {
+        const auto &vec = std::any_cast<const std::vector<T> &>(value);
+        auto arr = Napi::Array::New(env, vec.size());
+        for (size_t i = 0; i < vec.size(); ++i)
+        {
+            arr.Set(i, vec[i]);
+        }
+        return arr;
+    }
+
+    template <typename T, typename Convert>
+    inline std::any vectorToCpp(const Napi::Value &js_val, Convert convert)
+    {
+        auto arr = js_val.As<Napi::Array>();
+        std::vector<T> vec;
+        vec.reserve(arr.Length());
+        for (uint32_t i = 0; i < arr.Length(); ++i)
+        {
+            vec.push_back(convert(arr.Get(i)));
+        }
+        return vec;
+    }
+
+    // In-place conversions of the built-in types (JsConverter::direct)
+    template <typename T>
+    inline Napi::Value jsFrom(Napi::Env env, const void *value, const JsConverter &)
+    {
+        const auto &v = *static_cast<const T *>(value);
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            return Napi::String::New(env, v);
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            return Napi::Boolean::New(env, v);
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+        {
+            return Napi::Number::New(env, static_cast<double>(v));
+        }
+        else
+        {
+            auto arr = Napi::Array::New(env, v.size());
+            for (size_t i = 0; i < v.size(); ++i)
+            {
+                arr.Set(static_cast<uint32_t>(i), jsFrom<typename T::value_type>(env, &v[i], {}));
+            }
+            return arr;
+        }
+    }
+
+    template <typename T>
+    inline bool jsTo(const Napi::Value &js_value, void *value, const JsConverter &)
+    {
+        auto &v = *static_cast<T *>(value);
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            v = js_value.IsString() ? js_value.As<Napi::String>().Utf8Value()
+                                    : js_value.ToString().Utf8Value();
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            if (!js_value.IsBoolean())
+                return false;
+            v = js_value.As<Napi::Boolean>().Value();
+        }
+        else if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(int32_t))
+        {
+            if (!js_value.IsNumber())
+                return false;
+            v = static_cast<T>(js_value.As<Napi::Number>().Int32Value());
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            if (!js_value.IsNumber())
+                return false;
+            v = static_cast<T>(js_value.As<Napi::Number>().Int64Value());
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+        {
+            if (!js_value.IsNumber())
+                return false;
+            v = static_cast<T>(js_value.As<Napi::Number>().DoubleValue());
+        }
+        else
+        {
+            using Element = typename T::value_type;
+            if constexpr (std::is_arithmetic_v<Element> && !std::is_same_v<Element, bool>)
+            {
+                // Typed array of the exact element type: one copy
+                if (js_value.IsTypedArray())
+                {
+                    auto typed = js_value.As<Napi::TypedArray>();
+                    if (typed.ElementSize() != sizeof(Element) ||
+                        (std::is_floating_point_v<Element> !=
+                         (typed.TypedArrayType() == napi_float32_array ||
+                          typed.TypedArrayType() == napi_float64_array)))
+                        return false;
+                    T copy(typed.ElementLength());
+                    if (!copy.empty())
+                        std::memcpy(copy.data(),
+                                    static_cast<const char *>(typed.ArrayBuffer().Data()) + typed.ByteOffset(),
+                                    typed.ByteLength());
+                    v = std::move(copy);
+                    return true;
+                }
+            }
+            if (!js_value.IsArray())
+                return false;
+            auto arr = js_value.As<Napi::Array>();
+            T copy(arr.Length());
+            for (uint32_t i = 0; i < arr.Length(); ++i)
+            {
+                Element element{};
+                if (!jsTo<Element>(arr.Get(i), &element, {}))
+                    return false;
+                copy[i] = std::move(element);
+            }
+            v = std::move(copy);
+        }
+        return true;
+    }
+
+    // Conversions through the ValueCodec: native bridge or JSON form
+    inline Napi::Value codecToJs(Napi::Env env, const void *value, const JsConverter &self)
+    {
+        if (self.codec->to_js)
+        {
+            return Napi::Value(env, self.codec->to_js(env, value));
+        }
+        std::string json;
+        self.codec->write(json, value);
+        auto parse = env.Global().Get("JSON").As<Napi::Object>().Get("parse").As<Napi::Function>();
+        return parse.Call({Napi::String::New(env, json)});
+    }
+
+    inline bool codecFromJs(const Napi::Value &js_value, void *value, const JsConverter &self)
+    {
+        Napi::Env env = js_value.Env();
+        if (self.codec->from_js)
+        {
+            return self.codec->from_js(env, js_value, value);
+        }
+        auto stringify = env.Global().Get("JSON").As<Napi::Object>().Get("stringify").As<Napi::Function>();
+        return self.codec->read(stringify.Call({js_value}).As<Napi::String>().Utf8Value(), value);
+    }
+
+    template <typename E>
+    inline Napi::Value vectorView(Napi::Env env, std::vector<E> &vec, std::shared_ptr<void> owner,
+                                  napi_typedarray_type type)
+    {
+        if (vec.empty())
+        {
+            return Napi::TypedArrayOf<E>::New(env, 0, type);
+        }
+        auto *keep_alive = new std::shared_ptr<void>(std::move(owner));
+        auto buffer = Napi::ArrayBuffer::New(
+            env, vec.data(), vec.size() * sizeof(E),
+            [](Napi::Env, void *, std::shared_ptr<void> *hint)
+            { delete hint; },
+            keep_alive);
+        return Napi::TypedArrayOf<E>::New(env, vec.size(), buffer, 0, type);
+    }
+}
+
+inline Napi::Value JsConverter::toJs(Napi::Env env, const std::any &value) const
+{
+    if (!value.has_value() || isVoid())
+    {
+        return env.Undefined();
+    }
+    if (boxed_to_js)
+    {
+        return (*boxed_to_js)(env, value);
+    }
+    const void *ptr = codec ? codec->unbox(value) : nullptr;
+    if (!ptr || !to_js)
+    {
+        return env.Undefined();
+    }
+    return to_js(env, ptr, *this);
+}
+
+inline std::any JsConverter::toCpp(const Napi::Value &js_value) const
+{
+    if (boxed_to_cpp)
+    {
+        return (*boxed_to_cpp)(js_value);
+    }
+    if (!codec || !from_js)
+    {
+        throw std::runtime_error("Unsupported type: " + type_name);
+    }
+    std::any result;
+    assign(js_value, codec->emplace(result));
+    return result;
+}
+
+inline void JsConverter::assign(const Napi::Value &js_value, void *value) const
+{
+    if (!from_js(js_value, value, *this))
+    {
+        throw Napi::TypeError::New(js_value.Env(), "Invalid value for type: " + type_name);
+    }
+}
+
+// ------------------------------------------------
+
 template <typename T>
 inline Napi::Object ObjectWrapper<T>::Init(Napi::Env env, Napi::Object exports,
                                            const std::string &class_name)
 {
+    ResolveConverters();
+
+    std::deque<std::string> names; // Generated names, alive until DefineClass
     Napi::Function func =
-        ObjectWrapper::DefineClass(env, class_name.c_str(),
-                                   {
-                                       // These are just placeholders - real
-                                       // methods are added in constructor
-                                   });
+        ObjectWrapper::DefineClass(env, class_name.c_str(), ClassProperties(names));
 
     constructor = Napi::Persistent(func);
     constructor.SuppressDestruct();
@@ -70,59 +371,217 @@ inline Napi::Object ObjectWrapper<T>::Init(Napi::Env env, Napi::Object exports,
 }
 
 template <typename T>
-inline ObjectWrapper<T>::ObjectWrapper(const Napi::CallbackInfo &info)
-    : Napi::ObjectWrap<ObjectWrapper<T>>(info)
+inline void ObjectWrapper<T>::ResolveConverters()
 {
+    const auto &type_info = T::getStaticTypeInfo();
+    const auto &registry = TypeConverterRegistry::instance();
+    auto signature = [&](const auto &types, const auto &type_ids, TypeId result_id,
+                         const std::string &result_name)
+    {
+        Signature sig;
+        for (std::size_t i = 0; i < types.size(); ++i)
+        {
+            sig.parameters.push_back(registry.resolve(type_ids[i], types[i]));
+        }
+        sig.result = registry.resolve(result_id, result_name);
+        sig.framed = sig.result.framed();
+        for (const auto &parameter : sig.parameters)
+        {
+            sig.framed = sig.framed && !parameter.isVoid() && parameter.framed();
+        }
+        return sig;
+    };
 
-    auto env = info.Env();
+    member_converters.clear();
+    for (const auto &member : type_info.members)
+    {
+        member_converters.push_back(registry.resolve(member.type_id, member.type_name));
+    }
+
+    method_signatures.clear();
+    for (const auto &method : type_info.methods)
+    {
+        auto sig = signature(method.parameter_types, method.parameter_type_ids,
+                             method.return_type_id, method.return_type);
+        sig.framed = sig.framed && static_cast<bool>(method.frame_invoker);
+        method_signatures.push_back(std::move(sig));
+    }
 
-    // Get type info to access constructors
+    constructor_signatures.clear();
+    for (const auto &ctor : type_info.getConstructors())
+    {
+        constructor_signatures.push_back(signature(ctor->parameter_types, ctor->parameter_type_ids,
+                                                   typeId<void>(), "void"));
+    }
+}
+
+template <typename T>
+inline std::vector<typename ObjectWrapper<T>::PropertyDescriptor>
+ObjectWrapper<T>::ClassProperties(std::deque<std::string> &names)
+{
     const auto &type_info = T::getStaticTypeInfo();
-    const auto &ctors = type_info.getConstructors();
+    const auto method_attributes =
+        static_cast<napi_property_attributes>(napi_writable | napi_configurable);
+    const auto accessor_attributes =
+        static_cast<napi_property_attributes>(napi_enumerable | napi_configurable);
+    auto index_data = [](std::size_t index)
+    { return reinterpret_cast<void *>(static_cast<std::uintptr_t>(index)); };
 
-    // Find matching constructor based on argument count
-    const ConstructorInfo *matching_ctor = nullptr;
-    for (const auto &ctor : ctors)
+    std::vector<PropertyDescriptor> properties;
+
+    // Properties, plus explicit getter/setter methods
+    for (std::size_t i = 0; i < type_info.members.size(); ++i)
     {
-        if (ctor->parameter_types.size() == info.Length())
+        const auto &name = type_info.members[i].name;
+        properties.push_back(ObjectWrapper::InstanceAccessor(
+            name.c_str(), &ObjectWrapper::GetMember, &ObjectWrapper::SetMember,
+            accessor_attributes, index_data(i)));
+
+        const auto &getter = names.emplace_back("get" + Capitalize(name));
+        properties.push_back(ObjectWrapper::InstanceMethod(
+            getter.c_str(), &ObjectWrapper::GetMember, method_attributes, index_data(i)));
+        const auto &setter = names.emplace_back("set" + Capitalize(name));
+        properties.push_back(ObjectWrapper::InstanceMethod(
+            setter.c_str(), &ObjectWrapper::SetMemberMethod, method_attributes, index_data(i)));
+    }
+
+    // Methods
+    for (std::size_t i = 0; i < type_info.methods.size(); ++i)
+    {
+        const auto &name = type_info.methods[i].name;
+        // Skip ONLY if it's a simple getter/setter for an existing member
+        if (!IsSimpleGetterSetter(name, type_info))
         {
-            matching_ctor = ctor.get();
-            break;
+            properties.push_back(ObjectWrapper::InstanceMethod(
+                name.c_str(), &ObjectWrapper::CallMethodAt, method_attributes, index_data(i)));
         }
     }
 
-    if (!matching_ctor)
+    // Introspection
+    const std::pair<const char *, Napi::Value (ObjectWrapper::*)(const Napi::CallbackInfo &)> introspection[] = {
+        {"getClassName", &ObjectWrapper::GetClassName},
+        {"getMemberNames", &ObjectWrapper::GetMemberNames},
+        {"getMethodNames", &ObjectWrapper::GetMethodNames},
+        {"hasMember", &ObjectWrapper::HasMember},
+        {"hasMethod", &ObjectWrapper::HasMethod},
+        {"toJSON", &ObjectWrapper::ToJSON},
+        {"getMemberValue", &ObjectWrapper::GetMemberValue},
+        {"setMemberValue", &ObjectWrapper::SetMemberValue},
+        {"setMembers", &ObjectWrapper::SetMembers},
+        {"getMembers", &ObjectWrapper::GetMembers},
+        {"getMemberView", &ObjectWrapper::GetMemberView},
+        {"callMethod", &ObjectWrapper::CallMethod},
+    };
+    for (const auto &[name, method] : introspection)
     {
+        properties.push_back(ObjectWrapper::InstanceMethod(name, method, method_attributes));
+    }
+    return properties;
+}
+
+template <typename T>
+inline ObjectWrapper<T>::ObjectWrapper(const Napi::CallbackInfo &info)
+    : Napi::ObjectWrap<ObjectWrapper<T>>(info)
+{
+
+    auto env = info.Env();
+    const auto &ctors = T::getStaticTypeInfo().getConstructors();
+
+    try
+    {
+        // Overload resolution by argument types, in registration order
+        for (std::size_t c = 0; c < ctors.size(); ++c)
+        {
+            if (ctors[c]->parameter_types.size() == info.Length() &&
+                Construct(info, *ctors[c], constructor_signatures[c]))
+            {
+                return;
+            }
+        }
+        if (info.Length() != 0)
+        {
+            throw std::runtime_error("no constructor of '" + T::getStaticTypeInfo().class_name +
+                                     "' accepts " + std::to_string(info.Length()) +
+                                     " argument(s) of these types");
+        }
         // Default constructor as fallback
         cpp_obj = std::make_shared<T>();
     }
-    else
+    catch (const std::exception &e)
     {
-        try
+        Napi::Error::New(env, std::string("Constructor failed: ") + e.what())
+            .ThrowAsJavaScriptException();
+        cpp_obj = std::make_shared<T>(); // Fallback
+    }
+}
+
+namespace introspection::detail
+{
+    // Control block and object in one allocation, the object built in place
+    template <typename T>
+    struct InPlaceObject
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        bool constructed = false;
+
+        InPlaceObject() = default;
+        InPlaceObject(const InPlaceObject &) = delete;
+        InPlaceObject &operator=(const InPlaceObject &) = delete;
+        ~InPlaceObject()
         {
-            // Convert JS arguments to C++ std::any
-            std::vector<std::any> args;
-            for (size_t i = 0; i < info.Length(); ++i)
+            if (constructed)
             {
-                args.push_back(
-                    TypeConverterRegistry::instance().convert_to_cpp(
-                        info[i], matching_ctor->parameter_types[i]));
+                std::destroy_at(get());
             }
-
-            // Create object using factory and transfer ownership
-            void *raw_ptr = matching_ctor->factory(args);
-            cpp_obj = std::shared_ptr<T>(static_cast<T *>(raw_ptr));
         }
-        catch (const std::exception &e)
+
+        T *get() { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+}
+
+template <typename T>
+inline bool ObjectWrapper<T>::Construct(const Napi::CallbackInfo &info, const ConstructorInfo &ctor,
+                                        const Signature &signature)
+{
+    constexpr std::size_t max_framed = 8;
+    if (signature.framed && info.Length() <= max_framed)
+    {
+        // Arguments decoded into stack boxes; a mismatch selects the next overload
+        std::array<std::any, max_framed> boxes;
+        std::array<ArgView, max_framed> views;
+        for (size_t i = 0; i < info.Length(); ++i)
         {
-            Napi::Error::New(env, std::string("Constructor failed: ") + e.what())
-                .ThrowAsJavaScriptException();
-            cpp_obj = std::make_shared<T>(); // Fallback
+            const auto &parameter = signature.parameters[i];
+            void *value = parameter.codec->emplace(boxes[i]);
+            if (!parameter.from_js(info[i], value, parameter))
+            {
+                return false;
+            }
+            views[i] = ArgView{value, parameter.type_id, ArgView::Access::Move};
         }
+        auto object = std::make_shared<detail::InPlaceObject<T>>();
+        ctor.construct_at(object->storage, ArgFrame(views.data(), info.Length()));
+        object->constructed = true;
+        cpp_obj = std::shared_ptr<T>(object, object->get());
+        return true;
     }
 
-    // Setup all bindings
-    SetupBindings();
+    // Custom converters: boxed arguments through the heap factory
+    std::vector<std::any> args;
+    args.reserve(info.Length());
+    for (size_t i = 0; i < info.Length(); ++i)
+    {
+        try
+        {
+            args.push_back(signature.parameters[i].toCpp(info[i]));
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+    }
+    cpp_obj = std::shared_ptr<T>(static_cast<T *>(ctor.factory(args)));
+    return true;
 }
 
 template <typename T>
@@ -132,286 +591,353 @@ inline T *ObjectWrapper<T>::GetCppObject()
 }
 
 template <typename T>
-inline void ObjectWrapper<T>::SetupBindings()
+inline std::uint32_t ObjectWrapper<T>::IndexOf(const Napi::CallbackInfo &info)
 {
-    auto env = this->Env();
-    auto obj = this->Value();
-    const auto &type_info = cpp_obj->getTypeInfo();
+    return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(info.Data()));
+}
 
-    // Bind properties
-    for (const auto &member_name : type_info.getMemberNames())
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::ReadMember(Napi::Env env, MemberHandle handle)
+{
+    const auto &converter = member_converters[handle.index];
+    if (converter.direct)
     {
-        SetupProperty(member_name);
+        const auto &mem = T::getStaticTypeInfo().memberAt(handle);
+        INTROSPECTION_STATS_SCOPE(mem.stats_slot);
+        return converter.to_js(env, mem.address(cpp_obj.get()), converter);
     }
+    return converter.toJs(env, cpp_obj->getMemberValue(handle));
+}
 
-    // Bind methods
-    for (const auto &method_name : type_info.getMethodNames())
+template <typename T>
+inline void ObjectWrapper<T>::WriteMember(MemberHandle handle, const Napi::Value &value)
+{
+    const auto &converter = member_converters[handle.index];
+    if (converter.direct)
     {
-        // Skip ONLY if it's a simple getter/setter for an existing member
-        if (!IsSimpleGetterSetter(method_name, type_info))
-        {
-            SetupMethod(method_name);
-        }
+        const auto &mem = T::getStaticTypeInfo().memberAt(handle);
+        INTROSPECTION_STATS_SCOPE(mem.stats_slot + 1);
+        converter.assign(value, mem.address(cpp_obj.get()));
+        cpp_obj->markChanged(handle);
+        return;
     }
+    cpp_obj->setMemberValue(handle, converter.toCpp(value));
+}
 
-    // Bind introspection
-    SetupIntrospection();
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMember(const Napi::CallbackInfo &info)
+{
+    try
+    {
+        return ReadMember(info.Env(), MemberHandle{IndexOf(info)});
+    }
+    catch (const std::exception &e)
+    {
+        Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+        return info.Env().Undefined();
+    }
 }
 
 template <typename T>
-inline void ObjectWrapper<T>::SetupProperty(const std::string &prop_name)
+inline void ObjectWrapper<T>::SetMember(const Napi::CallbackInfo &info, const Napi::Value &value)
 {
-    auto env = this->Env();
-    auto obj = this->Value();
+    try
+    {
+        WriteMember(MemberHandle{IndexOf(info)}, value);
+    }
+    catch (const std::exception &e)
+    {
+        Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+    }
+}
 
-    // Get Object.defineProperty
-    auto global = env.Global();
-    auto object_ctor = global.Get("Object").template As<Napi::Object>();
-    auto define_prop =
-        object_ctor.Get("defineProperty").template As<Napi::Function>();
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::SetMemberMethod(const Napi::CallbackInfo &info)
+{
+    if (info.Length() >= 1)
+    {
+        SetMember(info, info[0]);
+    }
+    return info.Env().Undefined();
+}
 
-    // Create descriptor
-    auto descriptor = Napi::Object::New(env);
-    descriptor.Set("enumerable", true);
-    descriptor.Set("configurable", true);
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::CallMethodAt(const Napi::CallbackInfo &info)
+{
+    try
+    {
+        const MethodHandle handle{IndexOf(info)};
+        const auto &meth = T::getStaticTypeInfo().methodAt(handle);
 
-    // Getter
-    descriptor.Set(
-        "get",
-        Napi::Function::New(
-            env,
-            [this, prop_name](const Napi::CallbackInfo &info) -> Napi::Value
+        if (info.Length() != meth.parameter_types.size())
+        {
+            std::string err =
+                "Expected " +
+                std::to_string(meth.parameter_types.size()) +
+                " arguments, got " + std::to_string(info.Length());
+            Napi::TypeError::New(info.Env(), err)
+                .ThrowAsJavaScriptException();
+            return info.Env().Undefined();
+        }
+
+        const auto &signature = method_signatures[handle.index];
+        constexpr std::size_t max_framed = 8;
+        if (signature.framed && info.Length() <= max_framed)
+        {
+            // Arguments decoded into stack boxes, passed by reference
+            std::array<std::any, max_framed> boxes;
+            std::array<ArgView, max_framed> views;
+            for (size_t i = 0; i < info.Length(); ++i)
             {
-                try
-                {
-                    auto val = cpp_obj->getMemberValue(prop_name);
-                    const auto *mem =
-                        cpp_obj->getTypeInfo().getMember(prop_name);
-                    return TypeConverterRegistry::instance().convert_to_js(
-                        info.Env(), val, mem->type_name);
-                }
-                catch (const std::exception &e)
-                {
-                    Napi::Error::New(info.Env(), e.what())
-                        .ThrowAsJavaScriptException();
-                    return info.Env().Undefined();
-                }
-            }));
-
-    // Setter
-    descriptor.Set(
-        "set",
-        Napi::Function::New(
-            env,
-            [this, prop_name](const Napi::CallbackInfo &info) -> Napi::Value
+                const auto &parameter = signature.parameters[i];
+                void *value = parameter.codec->emplace(boxes[i]);
+                parameter.assign(info[i], value);
+                views[i] = ArgView{value, parameter.type_id, ArgView::Access::Move};
+            }
+            std::any result;
+            ReturnSlot slot;
+            if (!signature.result.isVoid())
             {
-                try
-                {
-                    if (info.Length() < 1)
-                    {
-                        Napi::TypeError::New(info.Env(), "Expected 1 argument")
-                            .ThrowAsJavaScriptException();
-                        return info.Env().Undefined();
-                    }
-                    const auto *mem =
-                        cpp_obj->getTypeInfo().getMember(prop_name);
-                    auto cpp_val =
-                        TypeConverterRegistry::instance().convert_to_cpp(
-                            info[0], mem->type_name);
-                    cpp_obj->setMemberValue(prop_name, cpp_val);
-                    return info.Env().Undefined();
-                }
-                catch (const std::exception &e)
-                {
-                    Napi::Error::New(info.Env(), e.what())
-                        .ThrowAsJavaScriptException();
-                    return info.Env().Undefined();
-                }
-            }));
-
-    // Define the property
-    define_prop.Call({obj, Napi::String::New(env, prop_name), descriptor});
-
-    // Also add explicit getter/setter methods
-    std::string getter = "get" + Capitalize(prop_name);
-    std::string setter = "set" + Capitalize(prop_name);
-
-    obj.Set(getter,
-            Napi::Function::New(env, [this, prop_name](
-                                         const Napi::CallbackInfo &info)
-                                {
-                auto val = cpp_obj->getMemberValue(prop_name);
-                const auto *mem = cpp_obj->getTypeInfo().getMember(prop_name);
-                return TypeConverterRegistry::instance().convert_to_js(
-                    info.Env(), val, mem->type_name); }));
-
-    obj.Set(
-        setter, Napi::Function::New(env, [this, prop_name](
-                                             const Napi::CallbackInfo &info)
-                                    {
-            if (info.Length() >= 1) {
-                const auto *mem = cpp_obj->getTypeInfo().getMember(prop_name);
-                auto cpp_val = TypeConverterRegistry::instance().convert_to_cpp(
-                    info[0], mem->type_name);
-                cpp_obj->setMemberValue(prop_name, cpp_val);
+                slot = ReturnSlot{signature.result.codec->emplace(result), signature.result.type_id};
             }
-            return info.Env().Undefined(); }));
+            cpp_obj->invoke(handle, ArgFrame(views.data(), info.Length()), slot);
+            if (!slot.data)
+            {
+                return info.Env().Undefined();
+            }
+            return signature.result.to_js(info.Env(), slot.data, signature.result);
+        }
+
+        std::vector<std::any> args;
+        args.reserve(info.Length());
+        for (size_t i = 0; i < info.Length(); ++i)
+        {
+            args.push_back(signature.parameters[i].toCpp(info[i]));
+        }
+
+        auto result = cpp_obj->callMethod(handle, args);
+        return signature.result.toJs(info.Env(), result);
+    }
+    catch (const std::exception &e)
+    {
+        Napi::Error::New(info.Env(), e.what())
+            .ThrowAsJavaScriptException();
+        return info.Env().Undefined();
+    }
 }
 
 template <typename T>
-inline void ObjectWrapper<T>::SetupMethod(const std::string &method_name)
+inline Napi::Value ObjectWrapper<T>::GetClassName(const Napi::CallbackInfo &info)
 {
-    auto env = this->Env();
-    auto obj = this->Value();
+    return Napi::String::New(info.Env(), cpp_obj->getClassName());
+}
 
-    obj.Set(method_name,
-            Napi::Function::New(env, [this, method_name](
-                                         const Napi::CallbackInfo &info)
-                                {
-                try {
-                    const auto *meth =
-                        cpp_obj->getTypeInfo().getMethod(method_name);
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMemberNames(const Napi::CallbackInfo &info)
+{
+    auto names = cpp_obj->getMemberNames();
+    auto arr = Napi::Array::New(info.Env());
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        arr.Set(i, names[i]);
+    }
+    return arr;
+}
 
-                    if (info.Length() != meth->parameter_types.size()) {
-                        std::string err =
-                            "Expected " +
-                            std::to_string(meth->parameter_types.size()) +
-                            " arguments, got " + std::to_string(info.Length());
-                        Napi::TypeError::New(info.Env(), err)
-                            .ThrowAsJavaScriptException();
-                        return info.Env().Undefined();
-                    }
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMethodNames(const Napi::CallbackInfo &info)
+{
+    auto names = cpp_obj->getMethodNames();
+    auto arr = Napi::Array::New(info.Env());
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        arr.Set(i, names[i]);
+    }
+    return arr;
+}
 
-                    std::vector<std::any> args;
-                    for (size_t i = 0; i < info.Length(); ++i) {
-                        args.push_back(
-                            TypeConverterRegistry::instance().convert_to_cpp(
-                                info[i], meth->parameter_types[i]));
-                    }
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::HasMember(const Napi::CallbackInfo &info)
+{
+    if (info.Length() > 0 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        return Napi::Boolean::New(info.Env(), cpp_obj->hasMember(name));
+    }
+    return Napi::Boolean::New(info.Env(), false);
+}
+
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::HasMethod(const Napi::CallbackInfo &info)
+{
+    if (info.Length() > 0 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        return Napi::Boolean::New(info.Env(), cpp_obj->hasMethod(name));
+    }
+    return Napi::Boolean::New(info.Env(), false);
+}
+
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::ToJSON(const Napi::CallbackInfo &info)
+{
+    return Napi::String::New(info.Env(), cpp_obj->toJSON());
+}
 
-                    auto result = cpp_obj->callMethod(method_name, args);
-                    return TypeConverterRegistry::instance().convert_to_js(
-                        info.Env(), result, meth->return_type);
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMemberValue(const Napi::CallbackInfo &info)
+{
+    if (info.Length() > 0 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        auto val = cpp_obj->getMemberValue(name);
+        const auto *mem = cpp_obj->getTypeInfo().getMember(name);
+        if (!mem)
+        {
+            return info.Env().Undefined();
+        }
+        return TypeConverterRegistry::instance().convert_to_js(
+            info.Env(), val, mem->type_id, mem->type_name);
+    }
+    return info.Env().Undefined();
+}
 
-                } catch (const std::exception &e) {
-                    Napi::Error::New(info.Env(), e.what())
-                        .ThrowAsJavaScriptException();
-                    return info.Env().Undefined();
-                } }));
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::SetMemberValue(const Napi::CallbackInfo &info)
+{
+    if (info.Length() >= 2 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        const auto *mem = cpp_obj->getTypeInfo().getMember(name);
+        if (mem)
+        {
+            auto cpp_val = TypeConverterRegistry::instance().convert_to_cpp(
+                info[1], mem->type_id, mem->type_name);
+            cpp_obj->setMemberValue(name, cpp_val);
+        }
+    }
+    return info.Env().Undefined();
 }
 
+// setMembers({name: value, ...}): one C++ call for the whole update,
+// applied only if every value converts (unknown names are ignored)
 template <typename T>
-inline void ObjectWrapper<T>::SetupIntrospection()
+inline Napi::Value ObjectWrapper<T>::SetMembers(const Napi::CallbackInfo &info)
 {
-    auto env = this->Env();
-    auto obj = this->Value();
+    if (info.Length() > 0 && info[0].IsObject())
+    {
+        auto values = info[0].template As<Napi::Object>();
+        auto names = values.GetPropertyNames();
+        const auto &type_info = cpp_obj->getTypeInfo();
+        std::vector<MemberHandle> handles;
+        std::vector<std::any> cpp_values;
+        handles.reserve(names.Length());
+        cpp_values.reserve(names.Length());
+        for (uint32_t i = 0; i < names.Length(); ++i)
+        {
+            std::string name = names.Get(i).template As<Napi::String>().Utf8Value();
+            MemberHandle handle = type_info.findMember(name);
+            if (!handle)
+            {
+                continue;
+            }
+            handles.push_back(handle);
+            cpp_values.push_back(member_converters[handle.index].toCpp(values.Get(name)));
+        }
+        cpp_obj->setMembers(handles, cpp_values);
+    }
+    return info.Env().Undefined();
+}
 
-    obj.Set("getClassName",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                { return Napi::String::New(info.Env(), cpp_obj->getClassName()); }));
+// getMembers([name, ...]): {name: value, ...} of the known names
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMembers(const Napi::CallbackInfo &info)
+{
+    auto result = Napi::Object::New(info.Env());
+    if (info.Length() > 0 && info[0].IsArray())
+    {
+        auto names = info[0].template As<Napi::Array>();
+        const auto &type_info = cpp_obj->getTypeInfo();
+        for (uint32_t i = 0; i < names.Length(); ++i)
+        {
+            std::string name = names.Get(i).template As<Napi::String>().Utf8Value();
+            MemberHandle handle = type_info.findMember(name);
+            if (!handle)
+            {
+                continue;
+            }
+            result.Set(name, ReadMember(info.Env(), handle));
+        }
+    }
+    return result;
+}
 
-    obj.Set("getMemberNames",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                auto names = cpp_obj->getMemberNames();
-                auto arr = Napi::Array::New(info.Env());
-                for (size_t i = 0; i < names.size(); ++i) {
-                    arr.Set(i, names[i]);
-                }
-                return arr; }));
-
-    obj.Set("getMethodNames",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                auto names = cpp_obj->getMethodNames();
-                auto arr = Napi::Array::New(info.Env());
-                for (size_t i = 0; i < names.size(); ++i) {
-                    arr.Set(i, names[i]);
-                }
-                return arr; }));
-
-    obj.Set("hasMember",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                if (info.Length() > 0 && info[0].IsString()) {
-                    std::string name =
-                        info[0].template As<Napi::String>().Utf8Value();
-                    return Napi::Boolean::New(info.Env(),
-                                              cpp_obj->hasMember(name));
-                }
-                return Napi::Boolean::New(info.Env(), false); }));
-
-    obj.Set("hasMethod",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                if (info.Length() > 0 && info[0].IsString()) {
-                    std::string name =
-                        info[0].template As<Napi::String>().Utf8Value();
-                    return Napi::Boolean::New(info.Env(),
-                                              cpp_obj->hasMethod(name));
-                }
-                return Napi::Boolean::New(info.Env(), false); }));
-
-    obj.Set("toJSON",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                { return Napi::String::New(info.Env(), cpp_obj->toJSON()); }));
-
-    obj.Set("getMemberValue",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                if (info.Length() > 0 && info[0].IsString()) {
-                    std::string name =
-                        info[0].template As<Napi::String>().Utf8Value();
-                    auto val = cpp_obj->getMemberValue(name);
-                    const auto *mem = cpp_obj->getTypeInfo().getMember(name);
-                    return TypeConverterRegistry::instance().convert_to_js(
-                        info.Env(), val, mem ? mem->type_name : "unknown");
-                }
-                return info.Env().Undefined(); }));
-
-    obj.Set("setMemberValue",
-            Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                                {
-                if (info.Length() >= 2 && info[0].IsString()) {
-                    std::string name =
-                        info[0].template As<Napi::String>().Utf8Value();
-                    const auto *mem = cpp_obj->getTypeInfo().getMember(name);
-                    if (mem) {
-                        auto cpp_val =
-                            TypeConverterRegistry::instance().convert_to_cpp(
-                                info[1], mem->type_name);
-                        cpp_obj->setMemberValue(name, cpp_val);
-                    }
-                }
-                return info.Env().Undefined(); }));
+// getMemberView(name): Float64Array / Float32Array / Int32Array over the
+// storage of a vector<double> / vector<float> / vector<int> member, without
+// copying. The view keeps the object alive, but is only valid until the
+// vector is resized, and writes through it are not change-tracked.
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::GetMemberView(const Napi::CallbackInfo &info)
+{
+    if (info.Length() > 0 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        const auto &type_info = cpp_obj->getTypeInfo();
+        MemberHandle handle = type_info.findMember(name);
+        if (handle)
+        {
+            const auto &mem = type_info.memberAt(handle);
+            void *address = mem.address(cpp_obj.get());
+            switch (mem.type_id)
+            {
+            case typeId<std::vector<double>>():
+                return detail::vectorView(info.Env(), *static_cast<std::vector<double> *>(address),
+                                          cpp_obj, napi_float64_array);
+            case typeId<std::vector<float>>():
+                return detail::vectorView(info.Env(), *static_cast<std::vector<float> *>(address),
+                                          cpp_obj, napi_float32_array);
+            case typeId<std::vector<int>>():
+                return detail::vectorView(info.Env(), *static_cast<std::vector<int> *>(address),
+                                          cpp_obj, napi_int32_array);
+            }
+            Napi::TypeError::New(info.Env(), "Member '" + name + "' of type " + mem.type_name +
+                                                 " has no typed array view")
+                .ThrowAsJavaScriptException();
+        }
+    }
+    return info.Env().Undefined();
+}
 
-    obj.Set(
-        "callMethod",
-        Napi::Function::New(env, [this](const Napi::CallbackInfo &info)
-                            {
-            if (info.Length() > 0 && info[0].IsString()) {
-                std::string name =
-                    info[0].template As<Napi::String>().Utf8Value();
-                const auto *meth = cpp_obj->getTypeInfo().getMethod(name);
-                if (meth) {
-                    std::vector<std::any> args;
-                    if (info.Length() > 1 && info[1].IsArray()) {
-                        auto arr = info[1].template As<Napi::Array>();
-                        for (uint32_t i = 0; i < arr.Length() &&
-                                             i < meth->parameter_types.size();
-                             ++i) {
-                            args.push_back(
-                                TypeConverterRegistry::instance()
-                                    .convert_to_cpp(arr.Get(i),
-                                                    meth->parameter_types[i]));
-                        }
-                    }
-                    auto result = cpp_obj->callMethod(name, args);
-                    return TypeConverterRegistry::instance().convert_to_js(
-                        info.Env(), result, meth->return_type);
+template <typename T>
+inline Napi::Value ObjectWrapper<T>::CallMethod(const Napi::CallbackInfo &info)
+{
+    if (info.Length() > 0 && info[0].IsString())
+    {
+        std::string name = info[0].template As<Napi::String>().Utf8Value();
+        const auto *meth = cpp_obj->getTypeInfo().getMethod(name);
+        if (meth)
+        {
+            std::vector<std::any> args;
+            if (info.Length() > 1 && info[1].IsArray())
+            {
+                auto arr = info[1].template As<Napi::Array>();
+                for (uint32_t i = 0; i < arr.Length() &&
+                                     i < meth->parameter_types.size();
+                     ++i)
+                {
+                    args.push_back(
+                        TypeConverterRegistry::instance()
+                            .convert_to_cpp(arr.Get(i),
+                                            meth->parameter_type_ids[i],
+                                            meth->parameter_types[i]));
                 }
             }
-            return info.Env().Undefined(); }));
+            auto result = cpp_obj->callMethod(name, args);
+            return TypeConverterRegistry::instance().convert_to_js(
+                info.Env(), result, meth->return_type_id, meth->return_type);
+        }
+    }
+    return info.Env().Undefined();
 }
 
 template <typename T>
@@ -479,6 +1005,12 @@ inline std::string ObjectWrapper<T>::Capitalize(const std::string &str)
 // Static member definition
 template <typename T>
 Napi::FunctionReference ObjectWrapper<T>::constructor;
+template <typename T>
+std::vector<JsConverter> ObjectWrapper<T>::member_converters;
+template <typename T>
+std::vector<typename ObjectWrapper<T>::Signature> ObjectWrapper<T>::method_signatures;
+template <typename T>
+std::vector<typename ObjectWrapper<T>::Signature> ObjectWrapper<T>::constructor_signatures;
 
 // ================================================
 
@@ -518,47 +1050,129 @@ inline void TypeConverterRegistry::register_converter(const std::string &type_na
     js_to_cpp_converters[type_name] = to_cpp;
 }
 
+inline JsConverter TypeConverterRegistry::resolve(TypeId type_id,
+                                                  const std::string &type_name) const
+{
+    JsConverter converter;
+    converter.type_id = type_id;
+    converter.type_name = type_name;
+    converter.codec = ValueCodecRegistry::instance().find(type_id);
+
+    auto direct = [&]<typename T>()
+    {
+        converter.to_js = &detail::jsFrom<T>;
+        converter.from_js = &detail::jsTo<T>;
+        converter.direct = true;
+    };
+    switch (type_id)
+    {
+    case typeId<void>():
+        return converter;
+    case typeId<std::string>():
+        direct.template operator()<std::string>();
+        return converter;
+    case typeId<int>():
+        direct.template operator()<int>();
+        return converter;
+    case typeId<double>():
+        direct.template operator()<double>();
+        return converter;
+    case typeId<float>():
+        direct.template operator()<float>();
+        return converter;
+    case typeId<bool>():
+        direct.template operator()<bool>();
+        return converter;
+    case typeId<std::vector<int>>():
+        direct.template operator()<std::vector<int>>();
+        return converter;
+    case typeId<std::vector<float>>():
+        direct.template operator()<std::vector<float>>();
+        return converter;
+    case typeId<std::vector<double>>():
+        direct.template operator()<std::vector<double>>();
+        return converter;
+    case typeId<std::vector<std::string>>():
+        direct.template operator()<std::vector<std::string>>();
+        return converter;
+    }
+
+    auto to_js = cpp_to_js_converters.find(type_name); // Nodes are stable
+    auto to_cpp = js_to_cpp_converters.find(type_name);
+    if (to_js != cpp_to_js_converters.end() && to_cpp != js_to_cpp_converters.end())
+    {
+        converter.boxed_to_js = &to_js->second;
+        converter.boxed_to_cpp = &to_cpp->second;
+    }
+    else if (converter.codec)
+    {
+        converter.to_js = &detail::codecToJs;
+        converter.from_js = &detail::codecFromJs;
+    }
+    return converter;
+}
+
 inline Napi::Value
 TypeConverterRegistry::convert_to_js(Napi::Env env, const std::any &value,
+                                     TypeId type_id,
                                      const std::string &type_name) const
 {
-    if (!value.has_value() || type_name == "void")
+    if (!value.has_value() || type_id == typeId<void>())
     {
         return env.Undefined();
     }
 
-    auto it = cpp_to_js_converters.find(type_name);
-    if (it != cpp_to_js_converters.end())
-    {
-        return it->second(env, value);
-    }
-
     try
     {
-        if (type_name == "string")
-        {
-            return Napi::String::New(env, std::any_cast<std::string>(value));
-        }
-        else if (type_name == "int")
+        // Built-in types are resolved on the type id, without hashing the name
+        switch (type_id)
         {
+        case typeId<std::string>():
+            return Napi::String::New(env, std::any_cast<const std::string &>(value));
+        case typeId<int>():
             return Napi::Number::New(env, std::any_cast<int>(value));
-        }
-        else if (type_name == "double")
-        {
+        case typeId<double>():
             return Napi::Number::New(env, std::any_cast<double>(value));
-        }
-        else if (type_name == "float")
-        {
+        case typeId<float>():
             return Napi::Number::New(env, std::any_cast<float>(value));
-        }
-        else if (type_name == "bool")
-        {
+        case typeId<bool>():
             return Napi::Boolean::New(env, std::any_cast<bool>(value));
+        case typeId<std::vector<int>>():
+            return detail::vectorToJs<int>(env, value);
+        case typeId<std::vector<double>>():
+            return detail::vectorToJs<double>(env, value);
+        case typeId<std::vector<std::string>>():
+            return detail::vectorToJs<std::string>(env, value);
         }
     }
     catch (const std::bad_any_cast &)
     {
-        // Fall through
+        return env.Undefined();
+    }
+
+    auto it = cpp_to_js_converters.find(type_name);
+    if (it != cpp_to_js_converters.end())
+    {
+        return it->second(env, value);
+    }
+
+    if (const auto *codec = ValueCodecRegistry::instance().find(type_id))
+    {
+        const void *ptr = codec->unbox(value);
+        if (!ptr)
+        {
+            return env.Undefined();
+        }
+        if (codec->to_js)
+        {
+            return Napi::Value(env, codec->to_js(env, ptr));
+        }
+
+        // No native conversion: go through the JSON form
+        std::string json;
+        codec->write(json, ptr);
+        auto parse = env.Global().Get("JSON").As<Napi::Object>().Get("parse").As<Napi::Function>();
+        return parse.Call({Napi::String::New(env, json)});
     }
 
     return env.Undefined();
@@ -566,112 +1180,64 @@ TypeConverterRegistry::convert_to_js(Napi::Env env, const std::any &value,
 
 inline std::any
 TypeConverterRegistry::convert_to_cpp(const Napi::Value &js_value,
+                                      TypeId type_id,
                                       const std::string &type_name) const
 {
-    auto it = js_to_cpp_converters.find(type_name);
-    if (it != js_to_cpp_converters.end())
-    {
-        return it->second(js_value);
-    }
-
-    if (type_name == "string")
+    switch (type_id)
     {
+    case typeId<std::string>():
         return std::make_any<std::string>(
             js_value.IsString() ? js_value.As<Napi::String>().Utf8Value()
                                 : js_value.ToString().Utf8Value());
-    }
-    else if (type_name == "int")
-    {
+    case typeId<int>():
         return std::make_any<int>(js_value.As<Napi::Number>().Int32Value());
-    }
-    else if (type_name == "double")
-    {
+    case typeId<double>():
         return std::make_any<double>(js_value.As<Napi::Number>().DoubleValue());
-    }
-    else if (type_name == "float")
-    {
+    case typeId<float>():
         return std::make_any<float>(
             static_cast<float>(js_value.As<Napi::Number>().DoubleValue()));
-    }
-    else if (type_name == "bool")
-    {
+    case typeId<bool>():
         return std::make_any<bool>(js_value.As<Napi::Boolean>().Value());
+    case typeId<std::vector<int>>():
+        return detail::vectorToCpp<int>(js_value, [](const Napi::Value &v)
+                                        { return v.As<Napi::Number>().Int32Value(); });
+    case typeId<std::vector<double>>():
+        return detail::vectorToCpp<double>(js_value, [](const Napi::Value &v)
+                                           { return v.As<Napi::Number>().DoubleValue(); });
+    case typeId<std::vector<std::string>>():
+        return detail::vectorToCpp<std::string>(js_value, [](const Napi::Value &v)
+                                                { return v.As<Napi::String>().Utf8Value(); });
     }
 
-    throw std::runtime_error("Unsupported type: " + type_name);
-}
+    auto it = js_to_cpp_converters.find(type_name);
+    if (it != js_to_cpp_converters.end())
+    {
+        return it->second(js_value);
+    }
 
-inline TypeConverterRegistry::TypeConverterRegistry()
-{
-    // Register vector converters
-    register_converter(
-        "vector<int>",
-        [](Napi::Env env, const std::any &value) -> Napi::Value
-        {
-            auto vec = std::any_cast<std::vector<int>>(value);
-            auto arr = Napi::Array::New(env, vec.size());
-            for (size_t i = 0; i < vec.size(); ++i)
-            {
-                arr.Set(i, vec[i]);
-            }
-            return arr;
-        },
-        [](const Napi::Value &js_val) -> std::any
+    if (const auto *codec = ValueCodecRegistry::instance().find(type_id))
+    {
+        Napi::Env env = js_value.Env();
+        std::any result;
+        void *ptr = codec->emplace(result);
+        bool ok = false;
+        if (codec->from_js)
         {
-            auto arr = js_val.As<Napi::Array>();
-            std::vector<int> vec;
-            for (uint32_t i = 0; i < arr.Length(); ++i)
-            {
-                vec.push_back(arr.Get(i).As<Napi::Number>().Int32Value());
-            }
-            return vec;
-        });
-
-    register_converter(
-        "vector<double>",
-        [](Napi::Env env, const std::any &value) -> Napi::Value
+            ok = codec->from_js(env, js_value, ptr);
+        }
+        else
         {
-            auto vec = std::any_cast<std::vector<double>>(value);
-            auto arr = Napi::Array::New(env, vec.size());
-            for (size_t i = 0; i < vec.size(); ++i)
-            {
-                arr.Set(i, vec[i]);
-            }
-            return arr;
-        },
-        [](const Napi::Value &js_val) -> std::any
+            auto stringify = env.Global().Get("JSON").As<Napi::Object>().Get("stringify").As<Napi::Function>();
+            ok = codec->read(stringify.Call({js_value}).As<Napi::String>().Utf8Value(), ptr);
+        }
+        if (!ok)
         {
-            auto arr = js_val.As<Napi::Array>();
-            std::vector<double> vec;
-            for (uint32_t i = 0; i < arr.Length(); ++i)
-            {
-                vec.push_back(arr.Get(i).As<Napi::Number>().DoubleValue());
-            }
-            return vec;
-        });
+            throw std::runtime_error("Invalid value for type: " + type_name);
+        }
+        return result;
+    }
 
-    register_converter(
-        "vector<string>",
-        [](Napi::Env env, const std::any &value) -> Napi::Value
-        {
-            auto vec = std::any_cast<std::vector<std::string>>(value);
-            auto arr = Napi::Array::New(env, vec.size());
-            for (size_t i = 0; i < vec.size(); ++i)
-            {
-                arr.Set(i, vec[i]);
-            }
-            return arr;
-        },
-        [](const Napi::Value &js_val) -> std::any
-        {
-            auto arr = js_val.As<Napi::Array>();
-            std::vector<std::string> vec;
-            for (uint32_t i = 0; i < arr.Length(); ++i)
-            {
-                vec.push_back(arr.Get(i).As<Napi::String>().Utf8Value());
-            }
-            return vec;
-        });
+    throw std::runtime_error("Unsupported type: " + type_name);
 }
 
 // ============================================================
@@ -1,5 +1,70 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
 using namespace introspection;
 
+namespace introspection::detail
+{
+    // Views need numpy at runtime; without it vector members are copied to lists
+    inline bool numpyAvailable()
+    {
+        static const bool available = []
+        {
+            try
+            {
+                py::module_::import("numpy");
+                return true;
+            }
+            catch (const py::error_already_set &)
+            {
+                return false;
+            }
+        }();
+        return available;
+    }
+
+    template <typename M, typename T>
+    inline py::object gatherScalars(const std::vector<T *> &objects, MemberHandle member)
+    {
+        py::array_t<M> out(objects.size());
+        {
+            py::gil_scoped_release release;
+            batch::getMember<M, T>(std::span<T *const>(objects), member,
+                                   std::span<M>(out.mutable_data(), objects.size()));
+        }
+        return out;
+    }
+
+    // Vectors of one length per object, as the rows of a 2-D array
+    template <typename E, typename T>
+    inline py::object gatherRows(const std::vector<T *> &objects, MemberHandle member)
+    {
+        const std::size_t length =
+            objects.empty() ? 0 : objects.front()->template getMemberRef<std::vector<E>>(member).size();
+        for (const auto *object : objects)
+        {
+            if (object->template getMemberRef<std::vector<E>>(member).size() != length)
+            {
+                throw py::value_error("Cannot gather vectors of different lengths");
+            }
+        }
+        py::array_t<E> out({static_cast<py::ssize_t>(objects.size()), static_cast<py::ssize_t>(length)});
+        E *row = out.mutable_data();
+        for (const auto *object : objects)
+        {
+            if (length)
+            {
+                std::memcpy(row, object->template getMemberRef<std::vector<E>>(member).data(),
+                            length * sizeof(E));
+            }
+            row += length;
+        }
+        return out;
+    }
+}
+
 template <typename T>
 inline auto PyGenerator::bind_class(const std::string &class_name) -> py::class_<T>
 {
@@ -36,6 +101,9 @@ inline auto PyGenerator::bind_class(const std::string &class_name) -> py::class_
     // Add introspection utilities to Python
     bind_introspection_utilities<T>(py_class);
 
+    // Bulk access to one member of many objects
+    bind_gather<T>(py_class);
+
     return py_class;
 }
 
@@ -56,61 +124,76 @@ inline void PyGenerator::bind_constructors(py::class_<T> &py_class, const TypeIn
         return;
     }
 
-    // Bind each constructor using lambda with type erasure
-    for (const auto &ctor : constructors)
-    {
-        py_class.def(
-            "__init__",
-            [this, ctor_ptr = ctor.get()](T &self, py::args args)
-            {
-                // Convert Python args to C++ std::any vector
-                std::vector<std::any> cpp_args;
+    // One __init__ resolving the overload by argument types; the selected
+    // constructor builds the object straight into the instance storage
+    py_class.def(
+        "__init__",
+        [this, &type_info](T &self, py::args args)
+        {
+            constexpr std::size_t max_arguments = 8;
+            std::array<std::any, max_arguments> boxes;
+            std::array<ArgView, max_arguments> views;
 
-                if (args.size() != ctor_ptr->parameter_types.size())
+            if (args.size() <= max_arguments)
+            {
+                for (const auto &ctor : type_info.getConstructors())
                 {
-                    throw py::value_error(
-                        "Constructor expects " +
-                        std::to_string(ctor_ptr->parameter_types.size()) +
-                        " arguments, got " + std::to_string(args.size()));
+                    if (ctor->parameter_type_ids.size() == args.size() &&
+                        convert_python_arguments(args, *ctor, boxes.data(), views.data()))
+                    {
+                        ctor->construct_at(&self, ArgFrame(views.data(), args.size()));
+                        return;
+                    }
                 }
-
-                for (size_t i = 0; i < args.size(); ++i)
+            }
+            if constexpr (std::is_default_constructible_v<T>)
+            {
+                if (args.size() == 0)
                 {
-                    cpp_args.push_back(
-                        convert_python_to_any(args[i],
-                                              ctor_ptr->parameter_types[i]));
+                    new (&self) T();
+                    return;
                 }
-
-                // Call factory to create object and placement-new it
-                void *raw_ptr = ctor_ptr->factory(cpp_args);
-                new (&self) T(std::move(*static_cast<T *>(raw_ptr)));
-                delete static_cast<T *>(raw_ptr);
-            });
-    }
+            }
+            throw py::type_error("No constructor of '" + type_info.class_name + "' accepts " +
+                                 std::to_string(args.size()) + " argument(s) of these types");
+        },
+        "Construct from any registered constructor signature");
 }
 
 template <typename T>
 inline void PyGenerator::bind_members(py::class_<T> &py_class, const TypeInfo &type_info)
 {
-    for (const auto &member_name : type_info.getMemberNames())
+    for (std::size_t i = 0; i < type_info.members.size(); ++i)
     {
-        const auto *member = type_info.getMember(member_name);
-        if (!member)
+        const auto &member = type_info.members[i];
+        const std::string &member_name = member.name;
+        const MemberHandle handle{static_cast<std::uint32_t>(i)};
+
+        switch (member.type_id)
+        {
+        case typeId<std::vector<double>>():
+            bind_vector_member<T, double>(py_class, member, handle);
             continue;
+        case typeId<std::vector<float>>():
+            bind_vector_member<T, float>(py_class, member, handle);
+            continue;
+        case typeId<std::vector<int>>():
+            bind_vector_member<T, int>(py_class, member, handle);
+            continue;
+        }
 
         // Create Python property using introspection getter/setter
         py_class.def_property(
             member_name.c_str(),
             // Getter
-            [this, member_name](const T &obj) -> py::object
+            [this, member_name, handle](const T &obj) -> py::object
             {
                 try
                 {
-                    auto value = obj.getMemberValue(member_name);
-                    return convert_any_to_python(value,
-                                                 obj.getTypeInfo()
-                                                     .getMember(member_name)
-                                                     ->type_name);
+                    const auto &member_info = obj.getTypeInfo().memberAt(handle);
+                    return convert_any_to_python(obj.getMemberValue(handle),
+                                                 member_info.type_id,
+                                                 member_info.type_name);
                 }
                 catch (const std::exception &e)
                 {
@@ -119,15 +202,14 @@ inline void PyGenerator::bind_members(py::class_<T> &py_class, const TypeInfo &t
                 }
             },
             // Setter
-            [this, member_name](T &obj, py::object py_value)
+            [this, member_name, handle](T &obj, py::object py_value)
             {
                 try
                 {
-                    const auto *member_info =
-                        obj.getTypeInfo().getMember(member_name);
+                    const auto &member_info = obj.getTypeInfo().memberAt(handle);
                     auto cpp_value = convert_python_to_any(
-                        py_value, member_info->type_name);
-                    obj.setMemberValue(member_name, cpp_value);
+                        py_value, member_info.type_id, member_info.type_name);
+                    obj.setMemberValue(handle, cpp_value);
                 }
                 catch (const std::exception &e)
                 {
@@ -139,6 +221,56 @@ inline void PyGenerator::bind_members(py::class_<T> &py_class, const TypeInfo &t
     }
 }
 
+// Reading the property returns an ndarray over the vector storage, whose base
+// is the Python object, so the object outlives the view. The view is valid
+// until the vector is resized: an assignment of the same length copies in
+// place and keeps existing views valid.
+template <typename T, typename E>
+inline void PyGenerator::bind_vector_member(py::class_<T> &py_class, const MemberInfo &member,
+                                            MemberHandle handle)
+{
+    py_class.def_property(
+        member.name.c_str(),
+        // Getter
+        [handle](py::object self) -> py::object
+        {
+            auto &values = self.cast<T &>().template getMemberRef<std::vector<E>>(handle);
+            if (!detail::numpyAvailable())
+            {
+                return py::cast(values);
+            }
+            return py::array_t<E>(values.size(), values.data(), self);
+        },
+        // Setter: any array-like, converted to E by numpy, in one copy
+        [handle](T &obj, py::object py_value)
+        {
+            auto &values = obj.template getMemberRef<std::vector<E>>(handle);
+            if (!detail::numpyAvailable())
+            {
+                values = py_value.cast<std::vector<E>>();
+                obj.markChanged(handle);
+                return;
+            }
+            auto array = py::array_t<E, py::array::c_style | py::array::forcecast>::ensure(py_value);
+            if (!array || array.ndim() != 1)
+            {
+                throw py::value_error("Expected a 1-D sequence of numbers for member '" +
+                                      obj.getTypeInfo().memberAt(handle).name + "'");
+            }
+            const auto size = static_cast<std::size_t>(array.size());
+            if (size != values.size())
+            {
+                values.resize(size);
+            }
+            if (size)
+            {
+                std::memmove(values.data(), array.data(), size * sizeof(E)); // May be a view of itself
+            }
+            obj.markChanged(handle);
+        },
+        ("Access to " + member.name + " member (numpy view)").c_str());
+}
+
 template <typename T>
 inline void PyGenerator::bind_methods(py::class_<T> &py_class, const TypeInfo &type_info)
 {
@@ -178,7 +310,8 @@ inline void PyGenerator::bind_methods(py::class_<T> &py_class, const TypeInfo &t
                     for (size_t i = 0; i < args.size(); ++i)
                     {
                         cpp_args.push_back(convert_python_to_any(
-                            args[i], method_info->parameter_types[i]));
+                            args[i], method_info->parameter_type_ids[i],
+                            method_info->parameter_types[i]));
                     }
 
                     // Call method through introspection
@@ -186,6 +319,7 @@ inline void PyGenerator::bind_methods(py::class_<T> &py_class, const TypeInfo &t
 
                     // Convert result back to Python
                     return convert_any_to_python(result,
+                                                 method_info->return_type_id,
                                                  method_info->return_type);
                 }
                 catch (const std::exception &e)
@@ -209,7 +343,10 @@ inline void PyGenerator::bind_introspection_utilities(py::class_<T> &py_class)
                  "Get all method names");
     py_class.def("has_member", &T::hasMember, "Check if member exists");
     py_class.def("has_method", &T::hasMethod, "Check if method exists");
-    py_class.def("to_json", &T::toJSON, "Export object to JSON string");
+    py_class.def(
+        "to_json", [](const T &obj)
+        { return obj.toJSON(); },
+        "Export object to JSON string");
 
     // Dynamic member/method access
     py_class.def(
@@ -218,8 +355,10 @@ inline void PyGenerator::bind_introspection_utilities(py::class_<T> &py_class)
         {
             auto value = obj.getMemberValue(name);
             const auto *member = obj.getTypeInfo().getMember(name);
-            return convert_any_to_python(value, member ? member->type_name
-                                                       : "unknown");
+            if (!member)
+                return py::none();
+            return convert_any_to_python(value, member->type_id,
+                                         member->type_name);
         },
         "Get member value by name");
 
@@ -231,7 +370,7 @@ inline void PyGenerator::bind_introspection_utilities(py::class_<T> &py_class)
             if (!member)
                 throw py::value_error("Member not found: " + name);
             auto cpp_value =
-                convert_python_to_any(value, member->type_name);
+                convert_python_to_any(value, member->type_id, member->type_name);
             obj.setMemberValue(name, cpp_value);
         },
         "Set member value by name");
@@ -250,16 +389,64 @@ inline void PyGenerator::bind_introspection_utilities(py::class_<T> &py_class)
                 if (i < method->parameter_types.size())
                 {
                     cpp_args.push_back(convert_python_to_any(
-                        args[i], method->parameter_types[i]));
+                        args[i], method->parameter_type_ids[i],
+                        method->parameter_types[i]));
                 }
             }
 
             auto result = obj.callMethod(name, cpp_args);
-            return convert_any_to_python(result, method->return_type);
+            return convert_any_to_python(result, method->return_type_id,
+                                         method->return_type);
         },
         "Call method by name with arguments");
 }
 
+template <typename T>
+inline void PyGenerator::bind_gather(py::class_<T> &py_class)
+{
+    py_class.def_static(
+        "gather",
+        [](py::sequence objects, const std::string &name) -> py::object
+        {
+            const auto &type_info = T::getStaticTypeInfo();
+            const MemberHandle handle = type_info.findMember(name);
+            if (!handle)
+                throw py::value_error("Member not found: " + name);
+
+            std::vector<T *> pointers;
+            pointers.reserve(objects.size());
+            for (auto object : objects)
+            {
+                pointers.push_back(&object.cast<T &>());
+            }
+
+            const auto &member = type_info.memberAt(handle);
+            switch (member.type_id)
+            {
+            case typeId<int>():
+                return detail::gatherScalars<int>(pointers, handle);
+            case typeId<long long>():
+                return detail::gatherScalars<long long>(pointers, handle);
+            case typeId<float>():
+                return detail::gatherScalars<float>(pointers, handle);
+            case typeId<double>():
+                return detail::gatherScalars<double>(pointers, handle);
+            case typeId<bool>():
+                return detail::gatherScalars<bool>(pointers, handle);
+            case typeId<std::vector<int>>():
+                return detail::gatherRows<int>(pointers, handle);
+            case typeId<std::vector<float>>():
+                return detail::gatherRows<float>(pointers, handle);
+            case typeId<std::vector<double>>():
+                return detail::gatherRows<double>(pointers, handle);
+            }
+            throw py::type_error("Member '" + name + "' of type " + member.type_name +
+                                 " cannot be gathered into an array");
+        },
+        py::arg("objects"), py::arg("member"),
+        "Gather one numeric member of many objects into a numpy array (2-D for vectors)");
+}
+
 // Helper function to check if a method is a getter/setter
 inline bool PyGenerator::is_getter_setter_method(const std::string &method_name) const
 {
@@ -267,41 +454,45 @@ inline bool PyGenerator::is_getter_setter_method(const std::string &method_name)
            method_name.starts_with("set") || method_name.starts_with("is");
 }
 
-// Convert std::any to Python object based on type name
+// Convert std::any to Python object based on type id
 inline py::object PyGenerator::convert_any_to_python(const std::any &value,
+                                                     TypeId type_id,
                                                      const std::string &type_name) const
 {
-    if (value.has_value() == false || type_name == "void")
+    if (value.has_value() == false || type_id == typeId<void>())
     {
         return py::none();
     }
 
     try
     {
-        if (type_name == "string")
-        {
-            return py::cast(std::any_cast<std::string>(value));
-        }
-        else if (type_name == "int")
+        switch (type_id)
         {
+        case typeId<std::string>():
+            return py::cast(std::any_cast<const std::string &>(value));
+        case typeId<int>():
             return py::cast(std::any_cast<int>(value));
-        }
-        else if (type_name == "double")
-        {
+        case typeId<double>():
             return py::cast(std::any_cast<double>(value));
-        }
-        else if (type_name == "float")
-        {
+        case typeId<float>():
             return py::cast(std::any_cast<float>(value));
-        }
-        else if (type_name == "bool")
-        {
+        case typeId<bool>():
             return py::cast(std::any_cast<bool>(value));
-        }
-        else
-        {
-            // For custom types, try generic casting
-            // we may need to extend this for our custom types
+        default:
+            if (const auto *codec = ValueCodecRegistry::instance().find(type_id))
+            {
+                const void *ptr = codec->unbox(value);
+                if (!ptr)
+                    throw std::bad_any_cast();
+                if (codec->to_python)
+                    return py::reinterpret_steal<py::object>(codec->to_python(ptr));
+
+                // No native conversion: go through the JSON form
+                std::string json;
+                codec->write(json, ptr);
+                return py::module_::import("json").attr("loads")(json);
+            }
+            // For custom types without codec, try generic casting
             return py::cast(value);
         }
     }
@@ -312,38 +503,72 @@ inline py::object PyGenerator::convert_any_to_python(const std::any &value,
     }
 }
 
-// Convert Python object to std::any based on expected type
-inline std::any PyGenerator::convert_python_to_any(py::object py_value,
-                                                   const std::string &type_name) const
+// Convert Python object to std::any based on expected type id
+inline bool PyGenerator::convert_python_arguments(const py::args &args, const ConstructorInfo &ctor,
+                                                  std::any *boxes, ArgView *views) const
 {
-    try
+    for (std::size_t i = 0; i < args.size(); ++i)
     {
-        if (type_name == "string")
+        const TypeId type_id = ctor.parameter_type_ids[i];
+        const auto *codec = ValueCodecRegistry::instance().find(type_id);
+        if (!codec)
         {
-            return std::make_any<std::string>(py_value.cast<std::string>());
+            return false;
         }
-        else if (type_name == "int")
+        try
         {
-            return std::make_any<int>(py_value.cast<int>());
+            boxes[i] = convert_python_to_any(args[i], type_id, ctor.parameter_types[i]);
         }
-        else if (type_name == "double")
+        catch (const std::exception &)
         {
-            return std::make_any<double>(py_value.cast<double>());
+            return false; // Not this overload
         }
-        else if (type_name == "float")
+        views[i] = ArgView{codec->unbox(boxes[i]), type_id, ArgView::Access::Move};
+    }
+    return true;
+}
+
+inline std::any PyGenerator::convert_python_to_any(py::object py_value,
+                                                   TypeId type_id,
+                                                   const std::string &type_name) const
+{
+    try
+    {
+        switch (type_id)
         {
+        case typeId<std::string>():
+            return std::make_any<std::string>(py_value.cast<std::string>());
+        case typeId<int>():
+            return std::make_any<int>(py_value.cast<int>());
+        case typeId<double>():
+            return std::make_any<double>(py_value.cast<double>());
+        case typeId<float>():
             return std::make_any<float>(py_value.cast<float>());
-        }
-        else if (type_name == "bool")
-        {
+        case typeId<bool>():
             return std::make_any<bool>(py_value.cast<bool>());
-        }
-        else
+        default:
         {
-            // For custom types, this is more complex and would require
-            // additional type information or registration
-            throw py::type_error("Unsupported type conversion for: " +
-                                 type_name);
+            const auto *codec = ValueCodecRegistry::instance().find(type_id);
+            if (!codec)
+            {
+                throw py::type_error("Unsupported type conversion for: " +
+                                     type_name);
+            }
+
+            std::any result;
+            void *ptr = codec->emplace(result);
+            bool ok = codec->from_python
+                          ? codec->from_python(py_value.ptr(), ptr)
+                          : codec->read(py::module_::import("json")
+                                            .attr("dumps")(py_value)
+                                            .cast<std::string>(),
+                                        ptr);
+            if (!ok)
+            {
+                throw py::type_error("Invalid value for type: " + type_name);
+            }
+            return result;
+        }
         }
     }
     catch (const py::cast_error &e)
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline std::size_t alignSize(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        inline void *allocateAligned(std::size_t size, std::size_t alignment)
+        {
+            return ::operator new(size, std::align_val_t(alignment));
+        }
+
+        inline void deallocateAligned(void *pointer, std::size_t alignment)
+        {
+            ::operator delete(pointer, std::align_val_t(alignment));
+        }
+    }
+
+    inline HeapAllocator &HeapAllocator::instance()
+    {
+        static HeapAllocator allocator;
+        return allocator;
+    }
+
+    inline void *HeapAllocator::allocate(std::size_t size, std::size_t alignment)
+    {
+        return detail::allocateAligned(size, alignment);
+    }
+
+    inline void HeapAllocator::deallocate(void *pointer, std::size_t, std::size_t alignment)
+    {
+        detail::deallocateAligned(pointer, alignment);
+    }
+
+    // ----------------------------------------------------------------
+
+    inline ObjectPool::ObjectPool(const TypeInfo &type, std::size_t objects_per_chunk)
+        : block_alignment(std::max<std::size_t>(type.object.alignment, alignof(FreeBlock))),
+          blocks_per_chunk(std::max<std::size_t>(objects_per_chunk, 1))
+    {
+        if (type.object.size == 0)
+        {
+            throw std::runtime_error("Cannot pool '" + type.class_name + "': its layout is unknown");
+        }
+        block_size = detail::alignSize(std::max<std::size_t>(type.object.size, sizeof(FreeBlock)), block_alignment);
+        next_block = blocks_per_chunk; // No chunk yet
+    }
+
+    inline ObjectPool::~ObjectPool()
+    {
+        for (void *chunk : chunk_list)
+        {
+            detail::deallocateAligned(chunk, block_alignment);
+        }
+    }
+
+    inline void *ObjectPool::allocate(std::size_t size, std::size_t alignment)
+    {
+        if (size > block_size || alignment > block_alignment)
+        {
+            throw std::runtime_error("Object of " + std::to_string(size) + " bytes does not fit a pool block of " +
+                                     std::to_string(block_size));
+        }
+        void *block = free_list;
+        if (free_list)
+        {
+            free_list = free_list->next;
+        }
+        else
+        {
+            if (next_block == blocks_per_chunk)
+            {
+                chunk_list.push_back(detail::allocateAligned(block_size * blocks_per_chunk, block_alignment));
+                next_block = 0;
+            }
+            block = static_cast<char *>(chunk_list.back()) + block_size * next_block++;
+        }
+        ++live_objects;
+        return block;
+    }
+
+    inline void ObjectPool::deallocate(void *pointer, std::size_t, std::size_t)
+    {
+        --live_objects;
+        free_list = ::new (pointer) FreeBlock{free_list};
+    }
+
+    // ----------------------------------------------------------------
+
+    inline Arena::Arena(std::size_t bytes_per_block) : block_size(bytes_per_block) {}
+
+    inline Arena::~Arena()
+    {
+        reset();
+    }
+
+    inline void *Arena::allocate(std::size_t size, std::size_t alignment)
+    {
+        // Offset of the first suitably aligned byte of the last block
+        auto aligned_start = [&]
+        {
+            auto base = reinterpret_cast<std::uintptr_t>(block_list.back().data);
+            return detail::alignSize(base + offset, alignment) - base;
+        };
+        std::size_t start = 0;
+        if (block_list.empty() || (start = aligned_start()) + size > block_list.back().size)
+        {
+            std::size_t bytes = std::max(block_size, size + alignment);
+            block_list.push_back(Block{detail::allocateAligned(bytes, alignof(std::max_align_t)), bytes});
+            offset = 0;
+            start = aligned_start();
+        }
+        offset = start + size;
+        bytes_used += size;
+        return static_cast<char *>(block_list.back().data) + start;
+    }
+
+    inline void Arena::reset()
+    {
+        for (const auto &block : block_list)
+        {
+            detail::deallocateAligned(block.data, alignof(std::max_align_t));
+        }
+        block_list.clear();
+        offset = 0;
+        bytes_used = 0;
+    }
+
+    // ----------------------------------------------------------------
+
+    inline ObjectHandle::ObjectHandle(ObjectHandle &&other) noexcept
+        : pointer(std::exchange(other.pointer, nullptr)), type_info(other.type_info), owner(other.owner)
+    {
+    }
+
+    inline ObjectHandle &ObjectHandle::operator=(ObjectHandle &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            pointer = std::exchange(other.pointer, nullptr);
+            type_info = other.type_info;
+            owner = other.owner;
+        }
+        return *this;
+    }
+
+    inline Introspectable *ObjectHandle::introspectable() const
+    {
+        return (pointer && type_info->object.introspectable) ? type_info->object.introspectable(pointer) : nullptr;
+    }
+
+    template <typename T>
+    inline T *ObjectHandle::as() const
+    {
+        return (pointer && type_info == &T::getStaticTypeInfo()) ? static_cast<T *>(pointer) : nullptr;
+    }
+
+    inline void ObjectHandle::reset()
+    {
+        if (pointer)
+        {
+            type_info->object.destroy(pointer);
+            owner->deallocate(pointer, type_info->object.size, type_info->object.alignment);
+            pointer = nullptr;
+        }
+    }
+
+    inline void *ObjectHandle::release()
+    {
+        return std::exchange(pointer, nullptr);
+    }
+
+    // ----------------------------------------------------------------
+
+    namespace detail
+    {
+        template <typename Construct>
+        inline ObjectHandle createWith(const TypeInfo &type, ObjectAllocator &allocator, Construct &&construct)
+        {
+            void *storage = allocator.allocate(type.object.size, type.object.alignment);
+            try
+            {
+                construct(storage);
+            }
+            catch (...)
+            {
+                allocator.deallocate(storage, type.object.size, type.object.alignment);
+                throw;
+            }
+            return ObjectHandle(storage, type, allocator);
+        }
+    }
+
+    inline ObjectHandle createObject(const TypeInfo &type, ObjectAllocator &allocator)
+    {
+        if (!type.object.construct)
+        {
+            throw std::runtime_error("Class '" + type.class_name + "' is not default constructible");
+        }
+        return detail::createWith(type, allocator, type.object.construct);
+    }
+
+    inline ObjectHandle createObject(const TypeInfo &type, ArgFrame args, ObjectAllocator &allocator)
+    {
+        if (const auto *ctor = type.findConstructor(args))
+        {
+            return detail::createWith(type, allocator, [&](void *storage)
+                                      { ctor->construct_at(storage, args); });
+        }
+        if (args.empty())
+        {
+            return createObject(type, allocator);
+        }
+        throw std::runtime_error("No constructor of '" + type.class_name + "' takes these argument types");
+    }
+
+    inline ObjectHandle clone(const Introspectable &source, ObjectAllocator &allocator)
+    {
+        const auto &type = source.getTypeInfo();
+        const auto &ops = type.object;
+        if (ops.copy_construct && ops.instance)
+        {
+            const void *from = ops.instance(const_cast<Introspectable *>(&source));
+            return detail::createWith(type, allocator, [&](void *storage)
+                                      { ops.copy_construct(storage, from); });
+        }
+        ObjectHandle copy = createObject(type, allocator);
+        copy.introspectable()->copyMembersFrom(source);
+        return copy;
+    }
+
+}
@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+namespace introspection
+{
+
+    inline SerialQueue::SerialQueue(ThreadPool &pool) : state(std::make_shared<State>())
+    {
+        state->pool = &pool;
+    }
+
+    inline void SerialQueue::submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock(state->mutex);
+            state->tasks.push_back(std::move(task));
+            if (state->draining)
+            {
+                return;
+            }
+            state->draining = true;
+        }
+        state->pool->submit([shared = state]
+                            { drain(shared); });
+    }
+
+    inline void SerialQueue::drain(const std::shared_ptr<State> &state)
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->tasks.empty())
+                {
+                    state->draining = false;
+                    return;
+                }
+                task = std::move(state->tasks.front());
+                state->tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    // ----------------------------------------------------------------
+
+    namespace detail
+    {
+        inline void AsyncState::complete(Arg value, std::exception_ptr exception)
+        {
+            std::function<void()> next;
+            {
+                std::lock_guard lock(mutex);
+                result = std::move(value);
+                error = std::move(exception);
+                done = true;
+                next.swap(continuation);
+            }
+            done_signal.notify_all();
+            if (next)
+            {
+                next();
+            }
+        }
+
+        inline bool AsyncState::chain(std::function<void()> next)
+        {
+            std::lock_guard lock(mutex);
+            if (done)
+            {
+                return false;
+            }
+            if (continuation)
+            {
+                throw std::runtime_error("Async result already has a continuation");
+            }
+            continuation = std::move(next);
+            return true;
+        }
+
+        inline AsyncState &requireState(const std::shared_ptr<AsyncState> &state)
+        {
+            if (!state)
+            {
+                throw std::runtime_error("Empty async result");
+            }
+            return *state;
+        }
+    }
+
+    inline bool AsyncResult::ready() const
+    {
+        auto &shared = detail::requireState(state);
+        std::lock_guard lock(shared.mutex);
+        return shared.done;
+    }
+
+    inline void AsyncResult::wait() const
+    {
+        auto &shared = detail::requireState(state);
+        std::unique_lock lock(shared.mutex);
+        shared.done_signal.wait(lock, [&]
+                                { return shared.done; });
+    }
+
+    inline Arg AsyncResult::get()
+    {
+        wait();
+        auto shared = std::move(state);
+        if (shared->error)
+        {
+            std::rethrow_exception(shared->error);
+        }
+        return std::move(shared->result);
+    }
+
+    inline void AsyncResult::then(std::function<void()> continuation)
+    {
+        if (!detail::requireState(state).chain(continuation))
+        {
+            continuation();
+        }
+    }
+
+    inline bool AsyncResult::await_suspend(std::coroutine_handle<> coroutine)
+    {
+        return detail::requireState(state).chain([coroutine]
+                                                 { coroutine.resume(); });
+    }
+
+    template <Executor E>
+    inline AsyncResult callMethodAsync(Introspectable &object, MethodHandle method, Args args, E &executor)
+    {
+        const auto &info = object.getTypeInfo().methodAt(method);
+        detail::checkArguments(info, args.size());
+
+        auto state = std::make_shared<detail::AsyncState>();
+        executor.submit([state, &object, &info, args = std::move(args)]
+                        {
+            Arg result;
+            std::exception_ptr error;
+            try
+            {
+                INTROSPECTION_STATS_SCOPE(info.stats_slot);
+                result = info.invoker(static_cast<void *>(&object), args);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            state->complete(std::move(result), std::move(error)); });
+        return AsyncResult(std::move(state));
+    }
+
+    template <Executor E>
+    inline AsyncResult callMethodAsync(Introspectable &object, const std::string &method_name, Args args,
+                                       E &executor)
+    {
+        auto method = object.getTypeInfo().findMethod(method_name);
+        if (!method)
+        {
+            throw std::runtime_error("Method '" + method_name + "' not found");
+        }
+        return callMethodAsync(object, method, std::move(args), executor);
+    }
+
+    // ----------------------------------------------------------------
+
+    namespace detail
+    {
+        // call(i) for i in [0, count): one claiming loop per thread
+        template <typename F>
+        inline void invokeAcross(std::size_t count, ThreadPool *pool, std::size_t min_chunk, F &&call)
+        {
+            min_chunk = std::max<std::size_t>(min_chunk, 1);
+            std::atomic<std::size_t> next{0};
+            std::mutex error_mutex;
+            std::exception_ptr error;
+            auto claim = [&]
+            {
+                for (std::size_t begin; (begin = next.fetch_add(min_chunk, std::memory_order_relaxed)) < count;)
+                {
+                    for (std::size_t i = begin, end = std::min(count, begin + min_chunk); i < end; ++i)
+                    {
+                        try
+                        {
+                            call(i);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard lock(error_mutex);
+                            if (!error)
+                            {
+                                error = std::current_exception();
+                            }
+                        }
+                    }
+                }
+            };
+            const std::size_t threads = pool ? std::min(pool->size() + 1, (count + min_chunk - 1) / min_chunk) : 1;
+            if (threads <= 1)
+            {
+                claim();
+            }
+            else
+            {
+                pool->parallelFor(threads, 1, [&](std::size_t, std::size_t)
+                                  { claim(); });
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // The frame shared by every call, read-only: no call may move from
+        // or write to an argument another thread is reading
+        inline std::vector<ArgView> sharedFrame(ArgFrame args)
+        {
+            std::vector<ArgView> frame(args.begin(), args.end());
+            for (auto &view : frame)
+            {
+                view.access = ArgView::Access::Read;
+            }
+            return frame;
+        }
+    }
+
+    inline void parallelInvoke(std::span<Introspectable *const> objects, MethodHandle method, ArgFrame args,
+                               ThreadPool *pool, std::size_t min_chunk)
+    {
+        const TypeInfo *type_info = batch::detail::commonTypeInfo(objects);
+        if (!type_info)
+        {
+            return;
+        }
+        const auto &info = type_info->methodAt(method);
+        detail::checkArguments(info, args.size());
+        const auto frame = detail::sharedFrame(args);
+        detail::invokeAcross(objects.size(), pool, min_chunk, [&](std::size_t i)
+                             {
+            INTROSPECTION_STATS_SCOPE(info.stats_slot);
+            info.frame_invoker(static_cast<void *>(objects[i]), frame, {}); });
+    }
+
+    template <typename T>
+    inline void parallelInvoke(std::span<T> objects, MethodHandle method, ArgFrame args, ThreadPool *pool,
+                               std::size_t min_chunk)
+    {
+        const auto &info = T::getStaticTypeInfo().methodAt(method);
+        detail::checkArguments(info, args.size());
+        const auto frame = detail::sharedFrame(args);
+        detail::invokeAcross(objects.size(), pool, min_chunk, [&](std::size_t i)
+                             {
+            INTROSPECTION_STATS_SCOPE(info.stats_slot);
+            info.frame_invoker(static_cast<void *>(&objects[i]), frame, {}); });
+    }
+
+}
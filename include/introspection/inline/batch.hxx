@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace introspection
+{
+
+    namespace batch::detail
+    {
+        template <typename F>
+        inline void forEachChunk(std::size_t count, ThreadPool *pool, std::size_t min_chunk, F &&body)
+        {
+            if (pool)
+            {
+                pool->parallelFor(count, min_chunk, body);
+            }
+            else if (count > 0)
+            {
+                body(std::size_t{0}, count);
+            }
+        }
+
+        // The TypeInfo shared by all the objects (nullptr if there are none)
+        template <typename Object>
+        inline const TypeInfo *commonTypeInfo(std::span<Object *const> objects)
+        {
+            const TypeInfo *type_info = nullptr;
+            for (const auto *object : objects)
+            {
+                if (!object)
+                {
+                    throw std::runtime_error("Null object in a batch");
+                }
+                const auto &object_type = object->getTypeInfo();
+                if (type_info && &object_type != type_info)
+                {
+                    throw std::runtime_error("Batch mixes objects of classes '" + type_info->class_name +
+                                             "' and '" + object_type.class_name + "'");
+                }
+                type_info = &object_type;
+            }
+            return type_info;
+        }
+
+        inline std::vector<const MemberInfo *> resolve(const TypeInfo &type_info,
+                                                       std::span<const MemberHandle> members)
+        {
+            std::vector<const MemberInfo *> resolved;
+            resolved.reserve(members.size());
+            for (auto handle : members)
+            {
+                resolved.push_back(&type_info.memberAt(handle));
+            }
+            return resolved;
+        }
+
+        inline void checkValueCount(std::size_t objects, std::size_t members, std::size_t values)
+        {
+            if (objects * members != values)
+            {
+                throw std::runtime_error("Batch of " + std::to_string(objects) + " objects and " +
+                                         std::to_string(members) + " members given " + std::to_string(values) +
+                                         " values");
+            }
+        }
+
+        inline void typeMismatch(const MemberInfo &member)
+        {
+            throw std::runtime_error("Type mismatch for member '" + member.name + "' (registered as " +
+                                     member.type_name + ")");
+        }
+
+        template <typename T>
+        inline void markChanged(T &object, MemberHandle member)
+        {
+            if constexpr (introspection::detail::ChangeTrackedClass<T>)
+            {
+                object.trackedChanges().mark(member);
+            }
+        }
+
+        // Member copies of one class, as byte offsets from the object address
+        struct CopyPlan
+        {
+            struct Run
+            {
+                std::size_t offset;
+                std::size_t size;
+            };
+            struct Assignment
+            {
+                std::size_t offset;
+                void (*copy_assign)(void *, const void *);
+            };
+
+            std::vector<Run> runs; // memcpy'd, sorted and merged
+            std::vector<Assignment> assignments;
+            std::vector<MemberHandle> members; // Marked changed
+
+            void apply(const void *source, void *target) const
+            {
+                const auto *from = static_cast<const char *>(source);
+                auto *to = static_cast<char *>(target);
+                for (const auto &run : runs)
+                {
+                    std::memcpy(to + run.offset, from + run.offset, run.size);
+                }
+                for (const auto &assignment : assignments)
+                {
+                    assignment.copy_assign(to + assignment.offset, from + assignment.offset);
+                }
+            }
+        };
+
+        // `sample` is any object of the class, addressed like the copied ones
+        inline CopyPlan planCopy(const TypeInfo &type_info, void *sample, std::span<const MemberHandle> members)
+        {
+            CopyPlan plan;
+            if (members.empty())
+            {
+                for (std::size_t i = 0; i < type_info.members.size(); ++i)
+                {
+                    plan.members.push_back(MemberHandle{static_cast<std::uint32_t>(i)});
+                }
+            }
+            else
+            {
+                plan.members.assign(members.begin(), members.end());
+            }
+
+            const auto *base = static_cast<const char *>(sample);
+            for (auto handle : plan.members)
+            {
+                const auto &member = introspection::detail::copyAssignable(type_info.memberAt(handle));
+                auto offset = static_cast<std::size_t>(static_cast<const char *>(member.address(sample)) - base);
+                if (member.ops.trivially_copyable)
+                {
+                    plan.runs.push_back(CopyPlan::Run{offset, member.ops.size});
+                }
+                else
+                {
+                    plan.assignments.push_back(CopyPlan::Assignment{offset, member.ops.copy_assign});
+                }
+            }
+
+            std::sort(plan.runs.begin(), plan.runs.end(), [](const auto &a, const auto &b)
+                      { return a.offset < b.offset; });
+            std::vector<CopyPlan::Run> merged;
+            for (const auto &run : plan.runs)
+            {
+                if (!merged.empty() && run.offset <= merged.back().offset + merged.back().size)
+                {
+                    merged.back().size = std::max(merged.back().size, run.offset + run.size - merged.back().offset);
+                }
+                else
+                {
+                    merged.push_back(run);
+                }
+            }
+            plan.runs = std::move(merged);
+            return plan;
+        }
+
+        template <typename M, typename T>
+        inline void checkMember(MemberHandle member)
+        {
+            const auto &info = T::getStaticTypeInfo().memberAt(member);
+            if (!info.template holds<M>())
+            {
+                typeMismatch(info);
+            }
+        }
+    }
+
+    inline void batch::getMembers(std::span<const Introspectable *const> objects,
+                                  std::span<const MemberHandle> members, std::span<Arg> out, ThreadPool *pool,
+                                  std::size_t min_chunk)
+    {
+        detail::checkValueCount(objects.size(), members.size(), out.size());
+        const auto *type_info = detail::commonTypeInfo(objects);
+        if (!type_info)
+        {
+            return;
+        }
+        const auto resolved = detail::resolve(*type_info, members);
+        const std::size_t width = resolved.size();
+
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    out[i * width + j] = resolved[j]->getter(objects[i]);
+                }
+            } });
+    }
+
+    inline void batch::setMembers(std::span<Introspectable *const> objects, std::span<const MemberHandle> members,
+                                  std::span<const Arg> values, ThreadPool *pool, std::size_t min_chunk)
+    {
+        detail::checkValueCount(objects.size(), members.size(), values.size());
+        const auto *type_info = detail::commonTypeInfo(objects);
+        if (!type_info)
+        {
+            return;
+        }
+        const auto resolved = detail::resolve(*type_info, members);
+        const std::size_t width = resolved.size();
+        for (std::size_t k = 0; k < values.size(); ++k)
+        {
+            if (std::type_index(values[k].type()) != resolved[k % width]->type)
+            {
+                detail::typeMismatch(*resolved[k % width]);
+            }
+        }
+
+        // Already type-checked: unbox and assign instead of the setter's any_cast
+        std::vector<const ValueCodec *> codecs;
+        codecs.reserve(width);
+        for (const auto *member : resolved)
+        {
+            const auto *codec = member->codec();
+            codecs.push_back(codec && codec->unbox && member->ops.copy_assign ? codec : nullptr);
+        }
+
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                void *object = objects[i];
+                auto *changes = objects[i]->changeSet();
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    const Arg &value = values[i * width + j];
+                    if (codecs[j])
+                    {
+                        resolved[j]->ops.copy_assign(resolved[j]->address(object), codecs[j]->unbox(value));
+                        if (changes)
+                            changes->mark(members[j]);
+                    }
+                    else
+                    {
+                        resolved[j]->setter(object, value); // Marks tracked objects itself
+                    }
+                }
+            } });
+    }
+
+    inline void batch::setMembers(std::span<Introspectable *const> objects, std::span<const MemberHandle> members,
+                                  ArgFrame values, ThreadPool *pool, std::size_t min_chunk)
+    {
+        detail::checkValueCount(objects.size(), members.size(), values.size());
+        const auto *type_info = detail::commonTypeInfo(objects);
+        if (!type_info)
+        {
+            return;
+        }
+        const auto resolved = detail::resolve(*type_info, members);
+        const std::size_t width = resolved.size();
+        for (const auto *member : resolved)
+        {
+            if (!member->ops.copy_assign)
+            {
+                throw std::runtime_error("Member '" + member->name + "' is not copy-assignable");
+            }
+        }
+        for (std::size_t k = 0; k < values.size(); ++k)
+        {
+            if (values[k].type != resolved[k % width]->type_id)
+            {
+                detail::typeMismatch(*resolved[k % width]);
+            }
+        }
+
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                void *object = objects[i];
+                auto *changes = objects[i]->changeSet();
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    resolved[j]->ops.copy_assign(resolved[j]->address(object), values[i * width + j].data);
+                    if (changes)
+                        changes->mark(members[j]);
+                }
+            } });
+    }
+
+    inline void batch::copyMembers(std::span<const Introspectable *const> sources,
+                                   std::span<Introspectable *const> targets, std::span<const MemberHandle> members,
+                                   ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(sources.size(), targets.size());
+        const auto *type_info = detail::commonTypeInfo(sources);
+        if (!type_info)
+        {
+            return;
+        }
+        if (detail::commonTypeInfo(targets) != type_info)
+        {
+            throw std::runtime_error("Batch copies objects of class '" + type_info->class_name +
+                                     "' into another class");
+        }
+        const auto plan = detail::planCopy(*type_info, targets[0], members);
+
+        detail::forEachChunk(sources.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (sources[i] == targets[i])
+                    continue;
+                plan.apply(sources[i], targets[i]);
+                if (auto *changes = targets[i]->changeSet())
+                {
+                    for (auto handle : plan.members)
+                        changes->mark(handle);
+                }
+            } });
+    }
+
+    template <typename T>
+    inline void batch::copyMembers(std::span<const T> sources, std::span<T> targets,
+                                   std::span<const MemberHandle> members, ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(sources.size(), targets.size());
+        if (sources.empty())
+        {
+            return;
+        }
+        const auto plan = detail::planCopy(T::getStaticTypeInfo(), &targets[0], members);
+
+        detail::forEachChunk(sources.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (&sources[i] == &targets[i])
+                    continue;
+                plan.apply(&sources[i], &targets[i]);
+                for (auto handle : plan.members)
+                    detail::markChanged(targets[i], handle);
+            } });
+    }
+
+    template <typename M, typename T>
+    inline void batch::getMember(std::span<const T> objects, MemberHandle member, std::span<M> out,
+                                 ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(objects.size(), out.size());
+        detail::checkMember<M, T>(member);
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             { bulk::gather<M>(objects.subspan(begin, end - begin), member,
+                                               out.subspan(begin, end - begin)); });
+    }
+
+    template <typename M, typename T>
+    inline void batch::getMember(std::span<T *const> objects, MemberHandle member, std::span<M> out,
+                                 ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(objects.size(), out.size());
+        detail::checkMember<M, T>(member);
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             { bulk::gather<M>(objects.subspan(begin, end - begin), member,
+                                               out.subspan(begin, end - begin)); });
+    }
+
+    template <typename M, typename T>
+    inline void batch::setMember(std::span<T> objects, MemberHandle member, std::span<const M> values,
+                                 ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(values.size(), objects.size());
+        detail::checkMember<M, T>(member);
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            bulk::scatter<M>(values.subspan(begin, end - begin), objects.subspan(begin, end - begin), member);
+            for (std::size_t i = begin; i < end; ++i)
+                detail::markChanged(objects[i], member); });
+    }
+
+    template <typename M, typename T>
+    inline void batch::setMember(std::span<T *const> objects, MemberHandle member, std::span<const M> values,
+                                 ThreadPool *pool, std::size_t min_chunk)
+    {
+        bulk::detail::checkSizes(values.size(), objects.size());
+        detail::checkMember<M, T>(member);
+        detail::forEachChunk(objects.size(), pool, min_chunk, [&](std::size_t begin, std::size_t end)
+                             {
+            bulk::scatter<M>(values.subspan(begin, end - begin), objects.subspan(begin, end - begin), member);
+            for (std::size_t i = begin; i < end; ++i)
+                detail::markChanged(*objects[i], member); });
+    }
+
+}
@@ -0,0 +1,179 @@
+#include <stdexcept>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline constexpr char binary_magic[4] = {'I', 'B', 'A', '1'};
+        inline constexpr std::uint32_t new_type_reference = 0xffffffffu;
+
+        // One entry per member: nullptr when it is copied raw
+        inline std::vector<const ValueCodec *> binaryCodecs(const TypeInfo &type_info)
+        {
+            std::vector<const ValueCodec *> codecs;
+            codecs.reserve(type_info.members.size());
+            for (const auto &member : type_info.members)
+            {
+                if (member.ops.trivially_copyable)
+                {
+                    codecs.push_back(nullptr);
+                    continue;
+                }
+                const auto *codec = member.codec();
+                if (!codec || !codec->write_binary)
+                {
+                    throw std::runtime_error("Member '" + member.name + "' of class '" + type_info.class_name +
+                                             "' has no binary encoding (type " + member.type_name + ")");
+                }
+                codecs.push_back(codec);
+            }
+            return codecs;
+        }
+
+        inline void binaryTruncated()
+        {
+            throw std::runtime_error("Truncated binary archive");
+        }
+    }
+
+    inline BinaryWriter::BinaryWriter(std::string &buffer) : out(buffer)
+    {
+        out.append(detail::binary_magic, sizeof(detail::binary_magic));
+    }
+
+    inline void BinaryWriter::write(const Introspectable &object)
+    {
+        const auto &type_info = object.getTypeInfo();
+
+        std::uint32_t reference = 0;
+        while (reference < types.size() && types[reference].type != &type_info)
+        {
+            ++reference;
+        }
+        if (reference == types.size())
+        {
+            types.push_back({&type_info, detail::binaryCodecs(type_info)});
+
+            const std::uint32_t marker = detail::new_type_reference;
+            detail::appendRaw(out, &marker, sizeof(marker));
+            ValueTraits<std::string>::writeBinary(out, type_info.class_name);
+            const std::uint64_t hash = type_info.schemaHash();
+            detail::appendRaw(out, &hash, sizeof(hash));
+        }
+        else
+        {
+            detail::appendRaw(out, &reference, sizeof(reference));
+        }
+
+        const auto &codecs = types[reference].codecs;
+        auto *self = const_cast<Introspectable *>(&object);
+        for (std::size_t i = 0; i < type_info.members.size(); ++i)
+        {
+            const auto &member = type_info.members[i];
+            const void *value = member.address(self);
+            if (codecs[i])
+                codecs[i]->write_binary(out, value);
+            else
+                detail::appendRaw(out, value, member.ops.size);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline BinaryReader::BinaryReader(std::string_view data) : in(data)
+    {
+        char magic[sizeof(detail::binary_magic)];
+        if (!detail::readRaw(in, magic, sizeof(magic)) ||
+            std::string_view(magic, sizeof(magic)) != std::string_view(detail::binary_magic, sizeof(magic)))
+        {
+            throw std::runtime_error("Not a binary archive");
+        }
+    }
+
+    inline BinaryReader::TypeRecord &BinaryReader::readTypeRecord()
+    {
+        std::uint32_t reference;
+        if (!detail::readRaw(in, &reference, sizeof(reference)))
+        {
+            detail::binaryTruncated();
+        }
+        if (reference == detail::new_type_reference)
+        {
+            TypeRecord record;
+            if (!ValueTraits<std::string>::readBinary(in, record.class_name) ||
+                !detail::readRaw(in, &record.schema_hash, sizeof(record.schema_hash)))
+            {
+                detail::binaryTruncated();
+            }
+            reference = static_cast<std::uint32_t>(types.size());
+            types.push_back(std::move(record));
+        }
+        if (reference >= types.size())
+        {
+            throw std::runtime_error("Invalid type reference in binary archive");
+        }
+        return types[reference];
+    }
+
+    inline void BinaryReader::bind(TypeRecord &record, const TypeInfo &type_info)
+    {
+        if (record.type != &type_info)
+        {
+            if (record.class_name != type_info.class_name || record.schema_hash != type_info.schemaHash())
+            {
+                throw std::runtime_error("Schema mismatch: archive holds '" + record.class_name +
+                                         "', cannot read it into '" + type_info.class_name + "'");
+            }
+            record.type = &type_info;
+            record.codecs = detail::binaryCodecs(type_info);
+        }
+    }
+
+    inline void BinaryReader::read(Introspectable &object)
+    {
+        auto &record = readTypeRecord();
+        bind(record, object.getTypeInfo());
+        readMembers(record, &object, object.changeSet());
+    }
+
+    inline ObjectHandle BinaryReader::readObject(ObjectAllocator &allocator)
+    {
+        auto &record = readTypeRecord();
+        if (!record.type)
+        {
+            const TypeInfo *type_info = TypeCatalog::instance().find(record.class_name);
+            if (!type_info)
+            {
+                throw std::runtime_error("Class '" + record.class_name +
+                                         "' of the binary archive is not in the type catalog");
+            }
+            bind(record, *type_info);
+        }
+        ObjectHandle object = createObject(*record.type, allocator);
+        Introspectable *target = object.introspectable();
+        readMembers(record, object.get(), target ? target->changeSet() : nullptr);
+        return object;
+    }
+
+    inline void BinaryReader::readMembers(const TypeRecord &record, void *object, ChangeSet *changes)
+    {
+        const auto &type_info = *record.type;
+        for (std::size_t i = 0; i < type_info.members.size(); ++i)
+        {
+            const auto &member = type_info.members[i];
+            void *value = member.address(object);
+            bool ok = record.codecs[i] ? record.codecs[i]->read_binary(in, value)
+                                       : detail::readRaw(in, value, member.ops.size);
+            if (!ok)
+            {
+                detail::binaryTruncated();
+            }
+            if (changes)
+            {
+                changes->mark(MemberHandle{static_cast<std::uint32_t>(i)});
+            }
+        }
+    }
+
+}
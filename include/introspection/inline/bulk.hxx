@@ -0,0 +1,480 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace introspection
+{
+
+    namespace bulk::detail
+    {
+        /**
+         * @brief Byte offset of `member` inside a T, checked to be an M. Members
+         * of a class sit at the same offset in every object of that class, so
+         * the address thunk is only called once.
+         */
+        template <typename M, typename T>
+        inline std::ptrdiff_t memberOffset(const T &object, MemberHandle member)
+        {
+            const auto &info = T::getStaticTypeInfo().memberAt(member);
+            if (!info.template holds<M>())
+            {
+                throw std::runtime_error("Type mismatch for member '" + info.name +
+                                         "' (registered as " + info.type_name + ")");
+            }
+            const auto *base = reinterpret_cast<const char *>(&object);
+            const void *address = info.address(const_cast<T *>(&object));
+            return static_cast<const char *>(address) - base;
+        }
+
+        template <typename M, typename T>
+        inline const M &at(const T &object, std::ptrdiff_t offset)
+        {
+            return *reinterpret_cast<const M *>(reinterpret_cast<const char *>(&object) + offset);
+        }
+
+        template <typename M, typename T>
+        inline M &at(T &object, std::ptrdiff_t offset)
+        {
+            return *reinterpret_cast<M *>(reinterpret_cast<char *>(&object) + offset);
+        }
+
+        inline void checkSizes(std::size_t a, std::size_t b)
+        {
+            if (a != b)
+            {
+                throw std::runtime_error("Bulk operation on ranges of different sizes (" + std::to_string(a) +
+                                         " and " + std::to_string(b) + ")");
+            }
+        }
+
+        // Scalar kernels ------------------------------------------------------
+
+        template <typename M>
+        inline SumType<M> sumScalar(const M *values, std::size_t n)
+        {
+            // Integers add up in unsigned 64 bits, which wrap instead of overflowing
+            using Accumulator = std::conditional_t<std::is_floating_point_v<M>, M, std::uint64_t>;
+
+            // Four independent accumulators, like the vector lanes
+            Accumulator s0{}, s1{}, s2{}, s3{};
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                s0 += static_cast<Accumulator>(values[i]);
+                s1 += static_cast<Accumulator>(values[i + 1]);
+                s2 += static_cast<Accumulator>(values[i + 2]);
+                s3 += static_cast<Accumulator>(values[i + 3]);
+            }
+            for (; i < n; ++i)
+            {
+                s0 += static_cast<Accumulator>(values[i]);
+            }
+            return static_cast<SumType<M>>((s0 + s1) + (s2 + s3));
+        }
+
+        // NaN as soon as one value is NaN, unlike std::min_element
+        template <bool Min, typename M>
+        inline M extremumScalar(const M *values, std::size_t n)
+        {
+            M result = values[0];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if constexpr (std::is_floating_point_v<M>)
+                {
+                    if (std::isnan(values[i]))
+                        return values[i];
+                }
+                result = Min ? std::min(result, values[i]) : std::max(result, values[i]);
+            }
+            return result;
+        }
+
+        template <typename M>
+        inline void scaleScalar(M *values, std::size_t n, M factor)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] *= factor;
+            }
+        }
+
+        template <typename M>
+        inline void axpyScalar(M a, const M *x, M *y, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                y[i] += a * x[i];
+            }
+        }
+
+        // Kernels, overloaded below with AVX2 versions for float, double and int
+
+        template <typename M>
+        inline SumType<M> sumKernel(const M *values, std::size_t n)
+        {
+            return sumScalar(values, n);
+        }
+
+        template <bool Min, typename M>
+        inline M extremumKernel(const M *values, std::size_t n)
+        {
+            return extremumScalar<Min>(values, n);
+        }
+
+        template <typename M>
+        inline void scaleKernel(M *values, std::size_t n, M factor)
+        {
+            scaleScalar(values, n, factor);
+        }
+
+        template <typename M>
+        inline void axpyKernel(M a, const M *x, M *y, std::size_t n)
+        {
+            axpyScalar(a, x, y, n);
+        }
+
+#if defined(__AVX2__)
+        // AVX2 kernels --------------------------------------------------------
+
+        inline float horizontalSum(__m256 v)
+        {
+            __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+            s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+            s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+            return _mm_cvtss_f32(s);
+        }
+
+        inline double horizontalSum(__m256d v)
+        {
+            __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+            s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+            return _mm_cvtsd_f64(s);
+        }
+
+        // Of four 64-bit lanes
+        inline std::uint64_t horizontalSum(__m256i v)
+        {
+            __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+            s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+            return static_cast<std::uint64_t>(_mm_cvtsi128_si64(s));
+        }
+
+        inline float sumKernel(const float *values, std::size_t n)
+        {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+            {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(values + i));
+                acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(values + i + 8));
+            }
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(values + i));
+            }
+            return horizontalSum(_mm256_add_ps(acc0, acc1)) + sumScalar(values + i, n - i);
+        }
+
+        inline double sumKernel(const double *values, std::size_t n)
+        {
+            __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(values + i));
+                acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(values + i + 4));
+            }
+            for (; i + 4 <= n; i += 4)
+            {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(values + i));
+            }
+            return horizontalSum(_mm256_add_pd(acc0, acc1)) + sumScalar(values + i, n - i);
+        }
+
+        inline std::int64_t sumKernel(const int *values, std::size_t n)
+        {
+            // Sign-extended to 64-bit lanes, as sumScalar() does
+            __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+                acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+            }
+            const std::uint64_t head = horizontalSum(_mm256_add_epi64(acc0, acc1));
+            return static_cast<std::int64_t>(head + static_cast<std::uint64_t>(sumScalar(values + i, n - i)));
+        }
+
+        template <bool Min>
+        inline float extremumKernel(const float *values, std::size_t n)
+        {
+            __m256 acc = _mm256_set1_ps(values[0]);
+            __m256 unordered = _mm256_setzero_ps();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256 v = _mm256_loadu_ps(values + i);
+                unordered = _mm256_or_ps(unordered, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+                acc = Min ? _mm256_min_ps(acc, v) : _mm256_max_ps(acc, v);
+            }
+            if (_mm256_movemask_ps(unordered) != 0)
+                return extremumScalar<Min>(values, n); // Same NaN as the scalar kernel
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, acc);
+            float result = lanes[0];
+            for (float lane : lanes)
+                result = Min ? std::min(result, lane) : std::max(result, lane);
+            for (; i < n; ++i)
+            {
+                if (std::isnan(values[i]))
+                    return values[i];
+                result = Min ? std::min(result, values[i]) : std::max(result, values[i]);
+            }
+            return result;
+        }
+
+        template <bool Min>
+        inline double extremumKernel(const double *values, std::size_t n)
+        {
+            __m256d acc = _mm256_set1_pd(values[0]);
+            __m256d unordered = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                const __m256d v = _mm256_loadu_pd(values + i);
+                unordered = _mm256_or_pd(unordered, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+                acc = Min ? _mm256_min_pd(acc, v) : _mm256_max_pd(acc, v);
+            }
+            if (_mm256_movemask_pd(unordered) != 0)
+                return extremumScalar<Min>(values, n); // Same NaN as the scalar kernel
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            double result = lanes[0];
+            for (double lane : lanes)
+                result = Min ? std::min(result, lane) : std::max(result, lane);
+            for (; i < n; ++i)
+            {
+                if (std::isnan(values[i]))
+                    return values[i];
+                result = Min ? std::min(result, values[i]) : std::max(result, values[i]);
+            }
+            return result;
+        }
+
+        template <bool Min>
+        inline int extremumKernel(const int *values, std::size_t n)
+        {
+            __m256i acc = _mm256_set1_epi32(values[0]);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+                acc = Min ? _mm256_min_epi32(acc, v) : _mm256_max_epi32(acc, v);
+            }
+            alignas(32) int lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+            int result = lanes[0];
+            for (int lane : lanes)
+                result = Min ? std::min(result, lane) : std::max(result, lane);
+            for (; i < n; ++i)
+                result = Min ? std::min(result, values[i]) : std::max(result, values[i]);
+            return result;
+        }
+
+        inline void scaleKernel(float *values, std::size_t n, float factor)
+        {
+            const __m256 f = _mm256_set1_ps(factor);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+                _mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), f));
+            scaleScalar(values + i, n - i, factor);
+        }
+
+        inline void scaleKernel(double *values, std::size_t n, double factor)
+        {
+            const __m256d f = _mm256_set1_pd(factor);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                _mm256_storeu_pd(values + i, _mm256_mul_pd(_mm256_loadu_pd(values + i), f));
+            scaleScalar(values + i, n - i, factor);
+        }
+
+        inline void scaleKernel(int *values, std::size_t n, int factor)
+        {
+            const __m256i f = _mm256_set1_epi32(factor);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                auto *p = reinterpret_cast<__m256i *>(values + i);
+                _mm256_storeu_si256(p, _mm256_mullo_epi32(_mm256_loadu_si256(p), f));
+            }
+            scaleScalar(values + i, n - i, factor);
+        }
+
+        inline void axpyKernel(float a, const float *x, float *y, std::size_t n)
+        {
+            if (n < 8)
+            {
+                // Short spans skip the vector loop, which GCC otherwise flags for them (-Warray-bounds)
+                axpyScalar(a, x, y, n);
+                return;
+            }
+            const __m256 va = _mm256_set1_ps(a);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+#if defined(__FMA__)
+                const __m256 r = _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+#else
+                const __m256 r = _mm256_add_ps(_mm256_mul_ps(va, _mm256_loadu_ps(x + i)), _mm256_loadu_ps(y + i));
+#endif
+                _mm256_storeu_ps(y + i, r);
+            }
+            axpyScalar(a, x + i, y + i, n - i);
+        }
+
+        inline void axpyKernel(double a, const double *x, double *y, std::size_t n)
+        {
+            const __m256d va = _mm256_set1_pd(a);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+#if defined(__FMA__)
+                const __m256d r = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+#else
+                const __m256d r = _mm256_add_pd(_mm256_mul_pd(va, _mm256_loadu_pd(x + i)), _mm256_loadu_pd(y + i));
+#endif
+                _mm256_storeu_pd(y + i, r);
+            }
+            axpyScalar(a, x + i, y + i, n - i);
+        }
+
+        inline void axpyKernel(int a, const int *x, int *y, std::size_t n)
+        {
+            const __m256i va = _mm256_set1_epi32(a);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+                auto *py = reinterpret_cast<__m256i *>(y + i);
+                _mm256_storeu_si256(py, _mm256_add_epi32(_mm256_mullo_epi32(va, vx), _mm256_loadu_si256(py)));
+            }
+            axpyScalar(a, x + i, y + i, n - i);
+        }
+#endif
+    }
+
+    // ------------------------------------------------------------------------
+
+    template <typename M, typename T>
+    inline void bulk::gather(std::span<const T> objects, MemberHandle member, std::span<M> out)
+    {
+        detail::checkSizes(objects.size(), out.size());
+        if (objects.empty())
+            return;
+        const auto offset = detail::memberOffset<M>(objects[0], member);
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            out[i] = detail::at<M>(objects[i], offset);
+        }
+    }
+
+    template <typename M, typename T>
+    inline void bulk::gather(std::span<T *const> objects, MemberHandle member, std::span<M> out)
+    {
+        detail::checkSizes(objects.size(), out.size());
+        if (objects.empty())
+            return;
+        const auto offset = detail::memberOffset<M>(*objects[0], member);
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            out[i] = detail::at<M>(*objects[i], offset);
+        }
+    }
+
+    template <typename M, typename T>
+    inline void bulk::scatter(std::span<const M> values, std::span<T> objects, MemberHandle member)
+    {
+        detail::checkSizes(values.size(), objects.size());
+        if (objects.empty())
+            return;
+        const auto offset = detail::memberOffset<M>(objects[0], member);
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            detail::at<M>(objects[i], offset) = values[i];
+        }
+    }
+
+    template <typename M, typename T>
+    inline void bulk::scatter(std::span<const M> values, std::span<T *const> objects, MemberHandle member)
+    {
+        detail::checkSizes(values.size(), objects.size());
+        if (objects.empty())
+            return;
+        const auto offset = detail::memberOffset<M>(*objects[0], member);
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            detail::at<M>(*objects[i], offset) = values[i];
+        }
+    }
+
+    template <bulk::NumericRange R>
+    inline bulk::SumOf<R> bulk::sum(const R &values)
+    {
+        using M = ValueOf<R>;
+        const M *data = std::ranges::data(values);
+        const std::size_t n = std::ranges::size(values);
+        return detail::sumKernel(data, n);
+    }
+
+    template <bulk::NumericRange R>
+    inline bulk::ValueOf<R> bulk::min(const R &values)
+    {
+        using M = ValueOf<R>;
+        const M *data = std::ranges::data(values);
+        const std::size_t n = std::ranges::size(values);
+        if (n == 0)
+            throw std::runtime_error("Minimum of an empty range");
+        return detail::extremumKernel<true>(data, n);
+    }
+
+    template <bulk::NumericRange R>
+    inline bulk::ValueOf<R> bulk::max(const R &values)
+    {
+        using M = ValueOf<R>;
+        const M *data = std::ranges::data(values);
+        const std::size_t n = std::ranges::size(values);
+        if (n == 0)
+            throw std::runtime_error("Maximum of an empty range");
+        return detail::extremumKernel<false>(data, n);
+    }
+
+    template <bulk::MutableNumericRange R>
+    inline void bulk::scale(R &&values, ValueOf<R> factor)
+    {
+        using M = ValueOf<R>;
+        M *data = std::ranges::data(values);
+        const std::size_t n = std::ranges::size(values);
+        detail::scaleKernel(data, n, factor);
+    }
+
+    template <bulk::NumericRange X, bulk::MutableNumericRange Y>
+        requires std::same_as<bulk::ValueOf<X>, bulk::ValueOf<Y>>
+    inline void bulk::axpy(ValueOf<Y> a, const X &x, Y &&y)
+    {
+        using M = ValueOf<Y>;
+        const std::size_t n = std::ranges::size(y);
+        detail::checkSizes(std::ranges::size(x), n);
+        const M *px = std::ranges::data(x);
+        M *py = std::ranges::data(y);
+        detail::axpyKernel(a, px, py, n);
+    }
+
+}
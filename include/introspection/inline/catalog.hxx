@@ -0,0 +1,200 @@
+#include <mutex>
+#include <stdexcept>
+
+namespace introspection
+{
+
+    inline TypeCatalog &TypeCatalog::instance()
+    {
+        static TypeCatalog catalog;
+        return catalog;
+    }
+
+    template <typename T>
+    inline void TypeCatalog::add(const std::string &name)
+    {
+        static_assert(std::is_base_of_v<Introspectable, T>, "T must be declared with INTROSPECTABLE");
+
+        std::unique_lock lock(mutex);
+        const TypeId type_id = typeId<T>();
+        if (by_id.count(type_id))
+        {
+            return;
+        }
+        if (by_name.count(name))
+        {
+            throw std::runtime_error("Type catalog already holds another class named '" + name + "'");
+        }
+        by_name.emplace(name, catalog.size());
+        by_id.emplace(type_id, catalog.size());
+        catalog.push_back(Entry{name, type_id, &T::getStaticTypeInfo});
+    }
+
+    inline const TypeInfo *TypeCatalog::find(std::string_view name) const
+    {
+        TypeInfo &(*type_info)();
+        {
+            std::shared_lock lock(mutex);
+            auto it = by_name.find(name);
+            if (it == by_name.end())
+            {
+                return nullptr;
+            }
+            type_info = catalog[it->second].type_info;
+        }
+        // Outside of the lock: building a TypeInfo may register type names
+        return &type_info();
+    }
+
+    inline const TypeInfo *TypeCatalog::find(TypeId type_id) const
+    {
+        TypeInfo &(*type_info)();
+        {
+            std::shared_lock lock(mutex);
+            auto it = by_id.find(type_id);
+            if (it == by_id.end())
+            {
+                return nullptr;
+            }
+            type_info = catalog[it->second].type_info;
+        }
+        // Outside of the lock: building a TypeInfo may register type names
+        return &type_info();
+    }
+
+    inline std::vector<std::string> TypeCatalog::names() const
+    {
+        std::shared_lock lock(mutex);
+        std::vector<std::string> result;
+        result.reserve(catalog.size());
+        for (const auto &entry : catalog)
+        {
+            result.push_back(entry.name);
+        }
+        return result;
+    }
+
+    inline std::size_t TypeCatalog::size() const
+    {
+        std::shared_lock lock(mutex);
+        return catalog.size();
+    }
+
+    inline std::vector<TypeCatalog::Entry> TypeCatalog::entries() const
+    {
+        std::shared_lock lock(mutex);
+        return catalog;
+    }
+
+    namespace detail
+    {
+        inline void addToStats(TypeCatalogStats &stats, const TypeCatalog::Entry &entry, const TypeInfo &info)
+        {
+            if (entry.already_built)
+            {
+                ++stats.already_built;
+                return;
+            }
+            ++stats.types;
+            stats.members += info.members.size();
+            stats.methods += info.methods.size();
+            stats.bytes += entry.bytes;
+            stats.duration += entry.duration;
+        }
+    }
+
+    inline TypeCatalogStats TypeCatalog::initializeAll()
+    {
+        std::vector<std::pair<std::size_t, TypeInfo &(*)()>> pending;
+        {
+            std::shared_lock lock(mutex);
+            for (std::size_t i = 0; i < catalog.size(); ++i)
+            {
+                if (!catalog[i].initialized)
+                {
+                    pending.emplace_back(i, catalog[i].type_info);
+                }
+            }
+        }
+
+        // A TypeInfo finished before this call was built on first use
+        const auto call_start = std::chrono::steady_clock::now();
+        TypeCatalogStats stats;
+        std::vector<Entry> built;
+        built.reserve(pending.size());
+        for (const auto &[index, type_info] : pending)
+        {
+            const TypeInfo &info = type_info();
+            Entry entry{};
+            entry.already_built = info.built_at < call_start;
+            entry.bytes = info.memoryFootprint();
+            entry.duration = info.build_duration;
+            detail::addToStats(stats, entry, info);
+            built.push_back(entry);
+        }
+
+        std::unique_lock lock(mutex);
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            auto &entry = catalog[pending[i].first];
+            if (!entry.initialized)
+            {
+                entry.initialized = true;
+                entry.already_built = built[i].already_built;
+                entry.bytes = built[i].bytes;
+                entry.duration = built[i].duration;
+            }
+        }
+        return stats;
+    }
+
+    inline TypeCatalogStats TypeCatalog::stats() const
+    {
+        std::shared_lock lock(mutex);
+        TypeCatalogStats stats;
+        for (const auto &entry : catalog)
+        {
+            if (entry.initialized)
+            {
+                detail::addToStats(stats, entry, entry.type_info());
+            }
+        }
+        return stats;
+    }
+
+    inline std::vector<TypeStats> TypeCatalog::callStats() const
+    {
+        std::vector<TypeInfo &(*)()> type_infos;
+        {
+            std::shared_lock lock(mutex);
+            for (const auto &entry : catalog)
+            {
+                type_infos.push_back(entry.type_info);
+            }
+        }
+        // Outside of the lock: building a TypeInfo may register type names
+        std::vector<TypeStats> result;
+        result.reserve(type_infos.size());
+        for (auto type_info : type_infos)
+        {
+            result.push_back(type_info().stats());
+        }
+        return result;
+    }
+
+    inline JsonWriter &TypeCatalog::writeCallStats(JsonWriter &out) const
+    {
+        out.beginArray();
+        for (const auto &stats : callStats())
+        {
+            stats.writeJSON(out);
+        }
+        return out.endArray();
+    }
+
+    inline TypeCatalogStats initializeAll()
+    {
+        return TypeCatalog::instance().initializeAll();
+    }
+
+}
@@ -0,0 +1,44 @@
+#include <stdexcept>
+#include <string>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline MemberHandle trackedMember(const TypeInfo &type_info, std::string_view member)
+        {
+            MemberHandle handle = type_info.findMember(member);
+            if (!handle)
+            {
+                throw std::runtime_error("Member '" + std::string(member) + "' not found");
+            }
+            return handle;
+        }
+    }
+
+    inline void ChangeTracked::markChanged(std::string_view member)
+    {
+        changes.mark(detail::trackedMember(getTypeInfo(), member));
+    }
+
+    inline bool ChangeTracked::isChanged(std::string_view member) const
+    {
+        return changes.test(detail::trackedMember(getTypeInfo(), member));
+    }
+
+    inline std::vector<MemberHandle> ChangeTracked::collectChanges()
+    {
+        std::vector<MemberHandle> changed;
+        collectChanges([&](MemberHandle member)
+                       { changed.push_back(member); });
+        return changed;
+    }
+
+    template <typename F>
+    inline void ChangeTracked::collectChanges(F &&visit)
+    {
+        changes.consume(getTypeInfo().members.size(), visit);
+    }
+
+}
@@ -0,0 +1,37 @@
+#include <utility>
+
+namespace introspection
+{
+
+    template <typename Class, typename Member>
+    constexpr Field<Class, Member> field(std::string_view name, Member Class::*pointer)
+    {
+        return Field<Class, Member>{name, pointer};
+    }
+
+    template <typename... Fields>
+    constexpr std::tuple<Fields...> describe(Fields... fields)
+    {
+        return std::tuple<Fields...>(fields...);
+    }
+
+    template <typename T, typename Visitor>
+        requires StaticallyDescribed<std::remove_const_t<T>>
+    constexpr void for_each_member(T &object, Visitor &&visitor)
+    {
+        constexpr auto fields = std::remove_const_t<T>::staticFields();
+        std::apply([&](const auto &...field)
+                   { (visitor(field.name, object.*(field.pointer)), ...); },
+                   fields);
+    }
+
+    template <StaticallyDescribed T, typename Visitor>
+    constexpr void for_each_field(Visitor &&visitor)
+    {
+        constexpr auto fields = T::staticFields();
+        std::apply([&](const auto &...field)
+                   { (visitor(field), ...); },
+                   fields);
+    }
+
+}
@@ -1,24 +1,163 @@
+#include <algorithm>
+#include <stdexcept>
+
 namespace introspection
 {
 
-    inline MemberInfo::MemberInfo(const std::string &n, const std::string &t,
-                                  std::function<std::any(const void *)> g,
-                                  std::function<void(void *, const Arg &)> s)
-        : name(n), type_name(t), getter(g), setter(s) {}
+    inline MemberInfo::MemberInfo(const std::string &n, const std::string &t, TypeId id, std::type_index ti,
+                                  MemberGetter g, MemberSetter s, MemberAddress a, ValueOps o)
+        : name(n), type_name(t), type_id(id), type(ti), getter(g), setter(s), address(a), ops(o),
+          resolved_codec(ValueCodecRegistry::instance().find(id)) {}
+
+    inline const ValueCodec *MemberInfo::codec() const
+    {
+        // Registry nodes are stable, so the pointer stays valid. A codec
+        // registered after the member is still found by the lookup
+        return resolved_codec ? resolved_codec : ValueCodecRegistry::instance().find(type_id);
+    }
 
     inline MethodInfo::MethodInfo(const std::string &n, const std::string &ret_type,
                                   const std::vector<std::string> &param_types,
-                                  std::function<std::any(void *, const Args &)> inv)
-        : name(n), return_type(ret_type), parameter_types(param_types), invoker(inv) {}
+                                  TypeId ret_type_id, const std::vector<TypeId> &param_type_ids,
+                                  MethodInvoker inv, FrameInvoker frame_inv)
+        : name(n), return_type(ret_type), parameter_types(param_types), return_type_id(ret_type_id),
+          parameter_type_ids(param_type_ids), invoker(inv), frame_invoker(frame_inv) {}
+
+    inline bool ConstructorInfo::accepts(std::span<const TypeId> argument_types) const
+    {
+        return std::equal(parameter_type_ids.begin(), parameter_type_ids.end(),
+                          argument_types.begin(), argument_types.end());
+    }
+
+    inline bool ConstructorInfo::accepts(ArgFrame args) const
+    {
+        return std::ranges::equal(parameter_type_ids, args, {}, {}, &ArgView::type);
+    }
+
+    namespace detail
+    {
+        template <typename Table>
+        inline void rebuildNameIndex(PerfectHashIndex &index, const Table &table)
+        {
+            std::vector<std::string_view> names;
+            names.reserve(table.size());
+            for (const auto &entry : table)
+            {
+                names.push_back(entry.name);
+            }
+            index.build(names);
+        }
+
+        template <typename Table>
+        inline std::uint32_t pendingIndexOf(const std::unordered_multimap<std::uint64_t, std::uint32_t> &pending,
+                                            const Table &table, std::string_view name)
+        {
+            if (pending.empty())
+            {
+                return PerfectHashIndex::npos;
+            }
+            auto [first, last] = pending.equal_range(fnv1a(name));
+            for (; first != last; ++first)
+            {
+                if (table[first->second].name == name)
+                {
+                    return first->second;
+                }
+            }
+            return PerfectHashIndex::npos;
+        }
+    }
+
+    inline std::uint32_t TypeInfo::memberIndexOf(std::string_view name) const
+    {
+        auto index = member_index.find(name, [this](std::uint32_t i) -> std::string_view
+                                       { return members[i].name; });
+        return index != PerfectHashIndex::npos ? index : detail::pendingIndexOf(pending_members, members, name);
+    }
+
+    inline std::uint32_t TypeInfo::methodIndexOf(std::string_view name) const
+    {
+        auto index = method_index.find(name, [this](std::uint32_t i) -> std::string_view
+                                       { return methods[i].name; });
+        return index != PerfectHashIndex::npos ? index : detail::pendingIndexOf(pending_methods, methods, name);
+    }
+
+    inline MemberHandle TypeInfo::addMember(MemberInfo member)
+    {
+        auto index = memberIndexOf(member.name);
+        if (index != PerfectHashIndex::npos)
+        {
+            member.stats_slot = members[index].stats_slot; // A replacement keeps the counters
+            members[index] = std::move(member);
+            return MemberHandle{index};
+        }
+        index = static_cast<std::uint32_t>(members.size());
+        pending_members.emplace(detail::fnv1a(member.name), index);
+        members.push_back(std::move(member));
+        return MemberHandle{index};
+    }
 
-    inline void TypeInfo::addMember(std::unique_ptr<MemberInfo> member)
+    inline MethodHandle TypeInfo::addMethod(MethodInfo method)
     {
-        members[member->name] = std::move(member);
+        auto index = methodIndexOf(method.name);
+        if (index != PerfectHashIndex::npos)
+        {
+            method.stats_slot = methods[index].stats_slot;
+            methods[index] = std::move(method);
+            return MethodHandle{index};
+        }
+        index = static_cast<std::uint32_t>(methods.size());
+        pending_methods.emplace(detail::fnv1a(method.name), index);
+        methods.push_back(std::move(method));
+        return MethodHandle{index};
+    }
+
+    inline void TypeInfo::finalize()
+    {
+        if (!pending_members.empty())
+        {
+            detail::rebuildNameIndex(member_index, members);
+            pending_members.clear();
+        }
+        if (!pending_methods.empty())
+        {
+            detail::rebuildNameIndex(method_index, methods);
+            pending_methods.clear();
+        }
     }
 
-    inline void TypeInfo::addMethod(std::unique_ptr<MethodInfo> method)
+    inline void TypeInfo::assignStatsSlots()
     {
-        methods[method->name] = std::move(method);
+        // One reservation for the whole class
+        std::uint32_t count = 0;
+        for (const auto &member : members)
+        {
+            count += member.stats_slot == detail::no_stats_slot ? 2 : 0;
+        }
+        for (const auto &method : methods)
+        {
+            count += method.stats_slot == detail::no_stats_slot ? 1 : 0;
+        }
+        if (count == 0)
+        {
+            return;
+        }
+        std::uint32_t next = detail::reserveStatsSlots(count);
+        for (auto &member : members)
+        {
+            if (member.stats_slot == detail::no_stats_slot)
+            {
+                member.stats_slot = next;
+                next += 2;
+            }
+        }
+        for (auto &method : methods)
+        {
+            if (method.stats_slot == detail::no_stats_slot)
+            {
+                method.stats_slot = next++;
+            }
+        }
     }
 
     inline void TypeInfo::addConstructor(std::unique_ptr<ConstructorInfo> ctor)
@@ -26,16 +165,46 @@ namespace introspection
         constructors.push_back(std::move(ctor));
     }
 
-    inline const MemberInfo *TypeInfo::getMember(const std::string &name) const
+    inline const MemberInfo *TypeInfo::getMember(std::string_view name) const
+    {
+        auto index = memberIndexOf(name);
+        return (index != PerfectHashIndex::npos) ? &members[index] : nullptr;
+    }
+
+    inline const MethodInfo *TypeInfo::getMethod(std::string_view name) const
+    {
+        auto index = methodIndexOf(name);
+        return (index != PerfectHashIndex::npos) ? &methods[index] : nullptr;
+    }
+
+    inline MemberHandle TypeInfo::findMember(std::string_view name) const
+    {
+        auto index = memberIndexOf(name);
+        return (index != PerfectHashIndex::npos) ? MemberHandle{index} : MemberHandle{};
+    }
+
+    inline MethodHandle TypeInfo::findMethod(std::string_view name) const
     {
-        auto it = members.find(name);
-        return (it != members.end()) ? it->second.get() : nullptr;
+        auto index = methodIndexOf(name);
+        return (index != PerfectHashIndex::npos) ? MethodHandle{index} : MethodHandle{};
     }
 
-    inline const MethodInfo *TypeInfo::getMethod(const std::string &name) const
+    inline const MemberInfo &TypeInfo::memberAt(MemberHandle handle) const
     {
-        auto it = methods.find(name);
-        return (it != methods.end()) ? it->second.get() : nullptr;
+        if (handle.index >= members.size())
+        {
+            throw std::runtime_error("Invalid member handle for class '" + class_name + "'");
+        }
+        return members[handle.index];
+    }
+
+    inline const MethodInfo &TypeInfo::methodAt(MethodHandle handle) const
+    {
+        if (handle.index >= methods.size())
+        {
+            throw std::runtime_error("Invalid method handle for class '" + class_name + "'");
+        }
+        return methods[handle.index];
     }
 
     inline const std::vector<std::unique_ptr<ConstructorInfo>> &
@@ -44,12 +213,37 @@ namespace introspection
         return constructors;
     }
 
+    inline const ConstructorInfo *TypeInfo::findConstructor(std::span<const TypeId> argument_types) const
+    {
+        for (const auto &ctor : constructors)
+        {
+            if (ctor->accepts(argument_types))
+            {
+                return ctor.get();
+            }
+        }
+        return nullptr;
+    }
+
+    inline const ConstructorInfo *TypeInfo::findConstructor(ArgFrame args) const
+    {
+        for (const auto &ctor : constructors)
+        {
+            if (ctor->accepts(args))
+            {
+                return ctor.get();
+            }
+        }
+        return nullptr;
+    }
+
     inline std::vector<std::string> TypeInfo::getMemberNames() const
     {
         std::vector<std::string> names;
-        for (const auto &pair : members)
+        names.reserve(members.size());
+        for (const auto &member : members)
         {
-            names.push_back(pair.first);
+            names.push_back(member.name);
         }
         return names;
     }
@@ -57,11 +251,110 @@ namespace introspection
     inline std::vector<std::string> TypeInfo::getMethodNames() const
     {
         std::vector<std::string> names;
-        for (const auto &pair : methods)
+        names.reserve(methods.size());
+        for (const auto &method : methods)
         {
-            names.push_back(pair.first);
+            names.push_back(method.name);
         }
         return names;
     }
 
-}
\ No newline at end of file
+    namespace detail
+    {
+        inline std::size_t heapBytes(const std::string &str)
+        {
+            // Strings living in the small-string buffer own no heap memory
+            return str.capacity() > std::string().capacity() ? str.capacity() + 1 : 0;
+        }
+
+        inline std::size_t heapBytes(const std::vector<std::string> &strings)
+        {
+            std::size_t bytes = strings.capacity() * sizeof(std::string);
+            for (const auto &str : strings)
+            {
+                bytes += heapBytes(str);
+            }
+            return bytes;
+        }
+    }
+
+    inline std::size_t TypeInfo::memoryFootprint() const
+    {
+        std::size_t bytes = sizeof(TypeInfo) + detail::heapBytes(class_name);
+
+        bytes += members.capacity() * sizeof(MemberInfo);
+        for (const auto &member : members)
+        {
+            bytes += detail::heapBytes(member.name) + detail::heapBytes(member.type_name);
+        }
+
+        bytes += methods.capacity() * sizeof(MethodInfo);
+        for (const auto &method : methods)
+        {
+            bytes += detail::heapBytes(method.name) + detail::heapBytes(method.return_type) +
+                     detail::heapBytes(method.parameter_types) +
+                     method.parameter_type_ids.capacity() * sizeof(TypeId);
+        }
+
+        bytes += constructors.capacity() * sizeof(std::unique_ptr<ConstructorInfo>);
+        for (const auto &ctor : constructors)
+        {
+            bytes += sizeof(ConstructorInfo) + detail::heapBytes(ctor->parameter_types) +
+                     ctor->parameter_type_ids.capacity() * sizeof(TypeId);
+        }
+
+        return bytes + member_index.memoryBytes() + method_index.memoryBytes();
+    }
+
+    inline std::uint64_t TypeInfo::schemaHash() const
+    {
+        // '\0' separators keep ("ab", "c") and ("a", "bc") apart
+        std::uint64_t hash = detail::fnv1a(class_name);
+        for (const auto &member : members)
+        {
+            hash = detail::fnv1a(std::string_view("\0", 1), hash);
+            hash = detail::fnv1a(member.name, hash);
+            hash = detail::fnv1a(std::string_view("\0", 1), hash);
+            hash = detail::fnv1a(member.type_name, hash);
+            hash ^= member.ops.size;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    inline TypeStats TypeInfo::stats() const
+    {
+        std::vector<std::uint32_t> slots;
+        slots.reserve(members.size() * 2 + methods.size());
+        for (const auto &member : members)
+        {
+            slots.push_back(member.stats_slot);
+            slots.push_back(member.stats_slot + 1);
+        }
+        for (const auto &method : methods)
+        {
+            slots.push_back(method.stats_slot);
+        }
+        std::vector<CallStats> counters(slots.size());
+        detail::StatsRegistry::instance().collect(slots, counters);
+
+        TypeStats result;
+        result.class_name = class_name;
+        auto counter = counters.begin();
+        for (const auto &member : members)
+        {
+            auto &entry = result.members.emplace_back();
+            entry.name = member.name;
+            entry.get = *counter++;
+            entry.set = *counter++;
+        }
+        for (const auto &method : methods)
+        {
+            auto &entry = result.methods.emplace_back();
+            entry.name = method.name;
+            entry.calls = *counter++;
+        }
+        return result;
+    }
+
+}
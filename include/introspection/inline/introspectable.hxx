@@ -1,4 +1,6 @@
-#include <sstream>
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 namespace introspection
@@ -11,6 +13,7 @@ namespace introspection
         const auto *member = type_info.getMember(member_name);
         if (member)
         {
+            INTROSPECTION_STATS_SCOPE(member->stats_slot);
             return member->getter(this);
         }
         throw std::runtime_error("Member '" + member_name + "' not found");
@@ -22,6 +25,7 @@ namespace introspection
         const auto *member = type_info.getMember(member_name);
         if (member)
         {
+            INTROSPECTION_STATS_SCOPE(member->stats_slot + 1);
             member->setter(const_cast<void *>(static_cast<const void *>(this)), value);
         }
         else
@@ -30,17 +34,337 @@ namespace introspection
         }
     }
 
+    namespace detail
+    {
+        inline void checkArguments(const MethodInfo &method, std::size_t count)
+        {
+            if (count != method.parameter_types.size())
+            {
+                throw std::runtime_error("Incorrect number of arguments for method '" + method.name +
+                                         "'. Expected " + std::to_string(method.parameter_types.size()) +
+                                         ", got " + std::to_string(count));
+            }
+        }
+    }
+
     inline Arg Introspectable::callMethod(const std::string &method_name, const Args &args)
     {
         const auto &type_info = getTypeInfo();
         const auto *method = type_info.getMethod(method_name);
         if (method)
         {
+            detail::checkArguments(*method, args.size());
+            INTROSPECTION_STATS_SCOPE(method->stats_slot);
             return method->invoker(const_cast<void *>(static_cast<const void *>(this)), args);
         }
         throw std::runtime_error("Method '" + method_name + "' not found");
     }
 
+    inline void Introspectable::markChanged(MemberHandle member)
+    {
+        if (auto *changes = changeSet())
+        {
+            changes->mark(member);
+        }
+    }
+
+    inline MemberHandle Introspectable::getMemberHandle(const std::string &member_name) const
+    {
+        return getTypeInfo().findMember(member_name);
+    }
+
+    inline MethodHandle Introspectable::getMethodHandle(const std::string &method_name) const
+    {
+        return getTypeInfo().findMethod(method_name);
+    }
+
+    inline Arg Introspectable::getMemberValue(MemberHandle member) const
+    {
+        const auto &info = getTypeInfo().memberAt(member);
+        INTROSPECTION_STATS_SCOPE(info.stats_slot);
+        return info.getter(this);
+    }
+
+    inline void Introspectable::setMemberValue(MemberHandle member, const Arg &value)
+    {
+        const auto &info = getTypeInfo().memberAt(member);
+        INTROSPECTION_STATS_SCOPE(info.stats_slot + 1);
+        info.setter(static_cast<void *>(this), value);
+    }
+
+    inline Arg Introspectable::callMethod(MethodHandle method, const Args &args)
+    {
+        const auto &info = getTypeInfo().methodAt(method);
+        detail::checkArguments(info, args.size());
+        INTROSPECTION_STATS_SCOPE(info.stats_slot);
+        return info.invoker(static_cast<void *>(this), args);
+    }
+
+    inline void Introspectable::invoke(MethodHandle method, ArgFrame args, ReturnSlot result)
+    {
+        const auto &info = getTypeInfo().methodAt(method);
+        detail::checkArguments(info, args.size());
+        INTROSPECTION_STATS_SCOPE(info.stats_slot);
+        info.frame_invoker(static_cast<void *>(this), args, result);
+    }
+
+    namespace detail
+    {
+        template <typename A>
+        inline ArgView forwardedArg(std::remove_reference_t<A> &arg)
+        {
+            if constexpr (std::is_lvalue_reference_v<A> || std::is_const_v<std::remove_reference_t<A>>)
+            {
+                return ArgView::of(arg);
+            }
+            else
+            {
+                return ArgView::movable(arg);
+            }
+        }
+    }
+
+    template <typename R, typename... A>
+    inline R Introspectable::call(MethodHandle method, A &&...args)
+    {
+        const std::array<ArgView, sizeof...(A)> frame{detail::forwardedArg<A>(args)...};
+        if constexpr (std::is_void_v<R>)
+        {
+            invoke(method, frame);
+        }
+        else
+        {
+            R result{};
+            invoke(method, frame, ReturnSlot::of(result));
+            return result;
+        }
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        inline void *typedMemberAddress(const MemberInfo &member, const void *obj)
+        {
+            if (!member.holds<T>())
+            {
+                throw std::runtime_error("Type mismatch for member '" + member.name +
+                                         "' (registered as " + member.type_name + ")");
+            }
+            return member.address(const_cast<void *>(obj));
+        }
+    }
+
+    template <typename T>
+    inline const T &Introspectable::getMemberRef(MemberHandle member) const
+    {
+        const auto &info = getTypeInfo().memberAt(member);
+        return *static_cast<const T *>(detail::typedMemberAddress<T>(info, this));
+    }
+
+    template <typename T>
+    inline T &Introspectable::getMemberRef(MemberHandle member)
+    {
+        const auto &info = getTypeInfo().memberAt(member);
+        return *static_cast<T *>(detail::typedMemberAddress<T>(info, this));
+    }
+
+    template <typename T>
+    inline void Introspectable::setMember(MemberHandle member, T &&value)
+    {
+        using ValueType = std::remove_cvref_t<T>;
+        const auto &info = getTypeInfo().memberAt(member);
+        *static_cast<ValueType *>(detail::typedMemberAddress<ValueType>(info, this)) = std::forward<T>(value);
+        markChanged(member);
+    }
+
+    namespace detail
+    {
+        inline void checkBatchSize(std::size_t members, std::size_t values)
+        {
+            if (members != values)
+            {
+                throw std::runtime_error("Batch of " + std::to_string(members) + " members given " +
+                                         std::to_string(values) + " values");
+            }
+        }
+
+        inline void checkBatchType(const MemberInfo &member, TypeId type)
+        {
+            if (member.type_id != type)
+            {
+                throw std::runtime_error("Type mismatch for member '" + member.name +
+                                         "' (registered as " + member.type_name + ")");
+            }
+        }
+
+        inline const MemberInfo &copyAssignable(const MemberInfo &member)
+        {
+            if (!member.ops.copy_assign)
+            {
+                throw std::runtime_error("Member '" + member.name + "' is not copy-assignable");
+            }
+            return member;
+        }
+    }
+
+    inline void Introspectable::getMembers(std::span<const MemberHandle> members, std::span<Arg> out) const
+    {
+        detail::checkBatchSize(members.size(), out.size());
+        const auto &type_info = getTypeInfo();
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            out[i] = type_info.memberAt(members[i]).getter(this);
+        }
+    }
+
+    inline void Introspectable::getMembers(std::span<const MemberHandle> members,
+                                           std::span<const ReturnSlot> out) const
+    {
+        detail::checkBatchSize(members.size(), out.size());
+        const auto &type_info = getTypeInfo();
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = detail::copyAssignable(type_info.memberAt(members[i]));
+            detail::checkBatchType(member, out[i].type);
+        }
+        auto *self = const_cast<Introspectable *>(this);
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = type_info.memberAt(members[i]);
+            member.ops.copy_assign(out[i].data, member.address(self));
+        }
+    }
+
+    inline void Introspectable::setMembers(std::span<const MemberHandle> members, std::span<const Arg> values)
+    {
+        detail::checkBatchSize(members.size(), values.size());
+        const auto &type_info = getTypeInfo();
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = type_info.memberAt(members[i]);
+            if (std::type_index(values[i].type()) != member.type)
+            {
+                throw std::runtime_error("Type mismatch for member '" + member.name +
+                                         "' (registered as " + member.type_name + ")");
+            }
+        }
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = type_info.memberAt(members[i]);
+            const auto *codec = member.codec();
+            if (codec && codec->unbox && member.ops.copy_assign)
+            {
+                // Already type-checked: skip the any_cast of the setter
+                member.ops.copy_assign(member.address(this), codec->unbox(values[i]));
+                markChanged(members[i]);
+            }
+            else
+            {
+                member.setter(static_cast<void *>(this), values[i]);
+            }
+        }
+    }
+
+    inline void Introspectable::setMembers(std::span<const MemberHandle> members, ArgFrame values)
+    {
+        detail::checkBatchSize(members.size(), values.size());
+        const auto &type_info = getTypeInfo();
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = detail::copyAssignable(type_info.memberAt(members[i]));
+            detail::checkBatchType(member, values[i].type);
+        }
+        auto *changes = changeSet();
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            const auto &member = type_info.memberAt(members[i]);
+            member.ops.copy_assign(member.address(this), values[i].data);
+            if (changes)
+            {
+                changes->mark(members[i]);
+            }
+        }
+    }
+
+    namespace detail
+    {
+        inline void checkSameClass(const TypeInfo &target, const TypeInfo &source)
+        {
+            if (&target != &source)
+            {
+                throw std::runtime_error("Cannot copy a '" + source.class_name + "' into a '" +
+                                         target.class_name + "'");
+            }
+        }
+
+        inline void copyMember(const MemberInfo &member, void *target, const void *source)
+        {
+            if (member.ops.trivially_copyable)
+            {
+                std::memcpy(target, source, member.ops.size);
+            }
+            else
+            {
+                member.ops.copy_assign(target, source);
+            }
+        }
+    }
+
+    inline void Introspectable::copyMembersFrom(const Introspectable &source, std::span<const MemberHandle> members)
+    {
+        const auto &type_info = getTypeInfo();
+        detail::checkSameClass(type_info, source.getTypeInfo());
+        if (&source == this)
+        {
+            return;
+        }
+        auto *from = const_cast<Introspectable *>(&source);
+        auto *changes = changeSet();
+        if (members.empty())
+        {
+            for (const auto &member : type_info.members)
+            {
+                detail::copyAssignable(member);
+            }
+            for (std::size_t i = 0; i < type_info.members.size(); ++i)
+            {
+                const auto &member = type_info.members[i];
+                detail::copyMember(member, member.address(this), member.address(from));
+            }
+            if (changes)
+            {
+                changes->markAll();
+            }
+            return;
+        }
+        for (auto handle : members)
+        {
+            detail::copyAssignable(type_info.memberAt(handle));
+        }
+        for (auto handle : members)
+        {
+            const auto &member = type_info.memberAt(handle);
+            detail::copyMember(member, member.address(this), member.address(from));
+            if (changes)
+            {
+                changes->mark(handle);
+            }
+        }
+    }
+
+    inline void Introspectable::copyFrom(const Introspectable &source)
+    {
+        const auto &type_info = getTypeInfo();
+        detail::checkSameClass(type_info, source.getTypeInfo());
+        const auto &ops = type_info.object;
+        if (ops.copy_assign && ops.instance)
+        {
+            ops.copy_assign(ops.instance(this), ops.instance(const_cast<Introspectable *>(&source)));
+            return;
+        }
+        copyMembersFrom(source);
+    }
+
     inline std::vector<std::string> Introspectable::getMemberNames() const
     {
         return getTypeInfo().getMemberNames();
@@ -72,34 +396,38 @@ namespace introspection
         const auto *member = type_info.getMember(member_name);
         if (member)
         {
-            auto value = member->getter(this);
+            const void *value = member->address(const_cast<Introspectable *>(this));
             std::cout << member_name << " (" << member->type_name << "): ";
 
             // Print based on type
-            // TODO: refactoring for genericity!
-            if (member->type_name == "string")
-            {
-                std::cout << std::any_cast<std::string>(value);
-            }
-            else if (member->type_name == "int")
-            {
-                std::cout << std::any_cast<int>(value);
-            }
-            else if (member->type_name == "double")
-            {
-                std::cout << std::any_cast<double>(value);
-            }
-            else if (member->type_name == "float")
-            {
-                std::cout << std::any_cast<float>(value);
-            }
-            else if (member->type_name == "bool")
+            switch (member->type_id)
             {
-                std::cout << (std::any_cast<bool>(value) ? "true" : "false");
-            }
-            else
-            {
-                std::cout << "[" << member->type_name << " value]";
+            case typeId<std::string>():
+                std::cout << *static_cast<const std::string *>(value);
+                break;
+            case typeId<int>():
+                std::cout << *static_cast<const int *>(value);
+                break;
+            case typeId<double>():
+                std::cout << *static_cast<const double *>(value);
+                break;
+            case typeId<float>():
+                std::cout << *static_cast<const float *>(value);
+                break;
+            case typeId<bool>():
+                std::cout << (*static_cast<const bool *>(value) ? "true" : "false");
+                break;
+            default:
+                if (const auto *codec = member->codec())
+                {
+                    std::string literal;
+                    codec->write(literal, value);
+                    std::cout << literal;
+                }
+                else
+                {
+                    std::cout << "[" << member->type_name << " value]";
+                }
             }
             std::cout << std::endl;
         }
@@ -115,27 +443,25 @@ namespace introspection
         std::cout << "Class: " << type_info.class_name << std::endl;
 
         std::cout << "Members:" << std::endl;
-        for (const auto &member_name : type_info.getMemberNames())
+        for (const auto &member : type_info.members)
         {
-            const auto *member = type_info.getMember(member_name);
-            std::cout << "  " << member->type_name << " " << member_name << std::endl;
+            std::cout << "  " << member.type_name << " " << member.name << std::endl;
         }
 
         std::cout << "Methods:" << std::endl;
-        for (const auto &method_name : type_info.getMethodNames())
+        for (const auto &method : type_info.methods)
         {
-            const auto *method = type_info.getMethod(method_name);
-            std::cout << "  " << method->return_type << "  " << method_name;
-            if (!method->parameter_types.empty())
+            std::cout << "  " << method.return_type << "  " << method.name;
+            if (!method.parameter_types.empty())
             {
                 std::cout << "(";
-                for (size_t i = 0; i < method->parameter_types.size(); ++i)
+                for (size_t i = 0; i < method.parameter_types.size(); ++i)
                 {
                     if (i > 0)
                     {
                         std::cout << ", ";
                     }
-                    std::cout << method->parameter_types[i];
+                    std::cout << method.parameter_types[i];
                 }
                 std::cout << ")";
             }
@@ -147,82 +473,265 @@ namespace introspection
         }
     }
 
-    inline std::string Introspectable::toJSON() const
+    inline void Introspectable::toJSON(JsonWriter &json, JsonContent content) const
     {
-        std::stringstream json;
         const auto &type_info = this->getTypeInfo();
+        auto *self = const_cast<Introspectable *>(this);
 
-        json << "{\n";
-        json << "  \"className\": \"" << type_info.class_name << "\",\n";
-        json << "  \"members\": [\n";
-
-        auto member_names = type_info.getMemberNames();
-        for (size_t i = 0; i < member_names.size(); ++i)
+        const auto writeValue = [&json, self](const MemberInfo &member)
         {
-            const auto *member = type_info.getMember(member_names[i]);
-            json << "    {\n";
-            json << "      \"name\": \"" << member->name << "\",\n";
-            json << "      \"type\": \"" << member->type_name << "\",\n";
-            json << "      \"value\": ";
+            if (const auto *codec = member.codec())
+                json.value(*codec, member.address(self));
+            else
+                json.null();
+        };
 
-            // Serialize current value
-            auto value = member->getter(this);
-            if (member->type_name == "string")
+        json.beginObject();
+        if (content == JsonContent::ValuesOnly)
+        {
+            for (const auto &member : type_info.members)
             {
-                json << "\"" << std::any_cast<std::string>(value) << "\"";
+                json.key(member.name);
+                writeValue(member);
             }
-            else if (member->type_name == "int")
+            json.endObject();
+            return;
+        }
+
+        json.key("className").value(type_info.class_name);
+
+        json.key("members").beginArray();
+        for (const auto &member : type_info.members)
+        {
+            json.beginObject();
+            json.key("name").value(member.name);
+            json.key("type").value(member.type_name);
+            json.key("value");
+            writeValue(member);
+            json.endObject();
+        }
+        json.endArray();
+
+        json.key("methods").beginArray();
+        for (const auto &method : type_info.methods)
+        {
+            json.beginObject();
+            json.key("name").value(method.name);
+            json.key("returnType").value(method.return_type);
+            json.key("parameters").beginArray();
+            for (const auto &parameter : method.parameter_types)
             {
-                json << std::any_cast<int>(value);
+                json.value(parameter);
             }
-            else if (member->type_name == "double")
+            json.endArray();
+            json.endObject();
+        }
+        json.endArray();
+
+        json.endObject();
+    }
+
+    inline std::string Introspectable::toJSON() const
+    {
+        std::string buffer;
+        JsonWriter json(buffer, JsonWriter::Style::Pretty);
+        toJSON(json);
+        return buffer;
+    }
+
+    namespace detail
+    {
+        inline void assignMemberJson(Introspectable &object, const MemberInfo &member, std::string_view literal,
+                                     std::size_t index, std::size_t offset, std::vector<JsonError> &errors)
+        {
+            const auto *codec = member.codec();
+            if (!codec)
             {
-                json << std::any_cast<double>(value);
+                errors.push_back({index, offset, "No codec for member '" + member.name + "' of type " + member.type_name});
             }
-            else if (member->type_name == "bool")
+            else if (!codec->read(literal, member.address(&object)))
             {
-                json << (std::any_cast<bool>(value) ? "true" : "false");
+                errors.push_back({index, offset, "Invalid value for member '" + member.name + "' (expected " + member.type_name + ")"});
             }
             else
             {
-                json << "null";
+                const auto &members = object.getTypeInfo().members;
+                object.markChanged(MemberHandle{static_cast<std::uint32_t>(&member - members.data())});
             }
-
-            json << "\n    }";
-            if (i < member_names.size() - 1)
-                json << ",";
-            json << "\n";
         }
 
-        json << "  ],\n";
-        json << "  \"methods\": [\n";
+        // Entries of the Full form: [{"name": ..., "type": ..., "value": ...}, ...]
+        inline void readMemberEntriesJson(Introspectable &object, JsonReader &reader, std::size_t index,
+                                          std::vector<JsonError> &errors)
+        {
+            const auto &type_info = object.getTypeInfo();
+            reader.beginArray();
+            while (reader.nextElement())
+            {
+                reader.peek();
+                const std::size_t offset = reader.offset();
+                std::string name;
+                std::string_view literal;
+                std::size_t value_offset = offset;
 
-        auto method_names = type_info.getMethodNames();
-        for (size_t i = 0; i < method_names.size(); ++i)
+                std::string_view key;
+                reader.beginObject();
+                while (reader.nextKey(key))
+                {
+                    if (key == "name")
+                    {
+                        if (!ValueTraits<std::string>::read(reader.value(), name))
+                        {
+                            errors.push_back({index, offset, "Invalid member name"});
+                        }
+                    }
+                    else if (key == "value")
+                    {
+                        reader.peek();
+                        value_offset = reader.offset();
+                        literal = reader.value();
+                    }
+                    else
+                    {
+                        reader.skipValue();
+                    }
+                }
+                if (reader.failed())
+                {
+                    return;
+                }
+
+                const auto *member = type_info.getMember(name);
+                if (!member)
+                {
+                    errors.push_back({index, offset, "Unknown member '" + name + "'"});
+                }
+                else if (!literal.empty())
+                {
+                    assignMemberJson(object, *member, literal, index, value_offset, errors);
+                }
+            }
+        }
+
+        inline void readObjectJson(Introspectable &object, JsonReader &reader, std::size_t index,
+                                   std::vector<JsonError> &errors)
         {
-            const auto *method = type_info.getMethod(method_names[i]);
-            json << "    {\n";
-            json << "      \"name\": \"" << method->name << "\",\n";
-            json << "      \"returnType\": \"" << method->return_type << "\",\n";
-            json << "      \"parameters\": [";
+            const auto &type_info = object.getTypeInfo();
+            if (!reader.beginObject())
+            {
+                return;
+            }
 
-            for (size_t j = 0; j < method->parameter_types.size(); ++j)
+            std::string_view key;
+            while (reader.nextKey(key))
             {
-                json << "\"" << method->parameter_types[j] << "\"";
-                if (j < method->parameter_types.size() - 1)
-                    json << ", ";
+                reader.peek(); // Point errors at the value
+                const std::size_t offset = reader.offset();
+                if (const auto *member = type_info.getMember(key))
+                {
+                    std::string_view literal = reader.value();
+                    if (reader.failed())
+                    {
+                        return;
+                    }
+                    assignMemberJson(object, *member, literal, index, offset, errors);
+                }
+                else if (key == "members" && reader.peek() == '[')
+                {
+                    readMemberEntriesJson(object, reader, index, errors);
+                }
+                else if (key == "className")
+                {
+                    std::string class_name;
+                    if (ValueTraits<std::string>::read(reader.value(), class_name) &&
+                        class_name != type_info.class_name)
+                    {
+                        errors.push_back({index, offset, "Class mismatch: expected '" + type_info.class_name +
+                                                             "', got '" + class_name + "'"});
+                    }
+                }
+                else if (key == "methods")
+                {
+                    reader.skipValue();
+                }
+                else
+                {
+                    errors.push_back({index, offset, "Unknown member '" + std::string(key) + "'"});
+                    reader.skipValue();
+                }
             }
+        }
+    }
 
-            json << "]\n    }";
-            if (i < method_names.size() - 1)
-                json << ",";
-            json << "\n";
+    inline std::vector<JsonError> Introspectable::fromJSON(std::string_view json)
+    {
+        std::vector<JsonError> errors;
+        JsonReader reader(json);
+        detail::readObjectJson(*this, reader, 0, errors);
+        if (!reader.failed() && !reader.atEnd())
+        {
+            errors.push_back({0, reader.offset(), "Unexpected characters after the object"});
         }
+        if (reader.failed())
+        {
+            errors.push_back({0, reader.offset(), reader.error()});
+        }
+        return errors;
+    }
+
+    template <typename T>
+    inline std::vector<JsonError> Introspectable::fromJSON(std::string_view json, std::vector<T> &objects)
+    {
+        static_assert(std::is_base_of_v<Introspectable, T>, "Type must inherit from Introspectable");
 
-        json << "  ]\n";
-        json << "}";
+        std::vector<JsonError> errors;
+        JsonReader reader(json);
+        std::size_t count = 0;
+        if (reader.beginArray())
+        {
+            while (reader.nextElement())
+            {
+                if (count == objects.size())
+                {
+                    objects.emplace_back();
+                }
+                detail::readObjectJson(objects[count], reader, count, errors);
+                if (reader.failed())
+                {
+                    break;
+                }
+                ++count;
+            }
+        }
+        if (!reader.failed() && !reader.atEnd())
+        {
+            errors.push_back({count, reader.offset(), "Unexpected characters after the array"});
+        }
+        if (reader.failed())
+        {
+            errors.push_back({count, reader.offset(), reader.error()});
+        }
+        else
+        {
+            objects.erase(objects.begin() + count, objects.end());
+        }
+        return errors;
+    }
 
-        return json.str();
+    namespace detail
+    {
+        template <typename Class>
+        inline TypeInfo buildTypeInfo(const char *class_name, void (*register_members)(TypeRegistrar<Class>))
+        {
+            const auto start = std::chrono::steady_clock::now();
+            TypeInfo type_info(class_name);
+            register_members(TypeRegistrar<Class>(type_info));
+            type_info.finalize();
+            type_info.assignStatsSlots();
+            type_info.built_at = std::chrono::steady_clock::now();
+            type_info.build_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(type_info.built_at - start);
+            return type_info;
+        }
     }
 
 } // namespace introspection
\ No newline at end of file
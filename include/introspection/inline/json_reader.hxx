@@ -0,0 +1,237 @@
+#include <introspection/value_codec.h>
+
+namespace introspection
+{
+
+    inline JsonReader::JsonReader(std::string_view json) : text(json) {}
+
+    inline void JsonReader::skipWhitespace()
+    {
+        while (pos < text.size() &&
+               (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+        {
+            ++pos;
+        }
+    }
+
+    inline bool JsonReader::fail(const char *message)
+    {
+        if (!error_message)
+        {
+            error_message = message;
+        }
+        return false;
+    }
+
+    inline char JsonReader::peek()
+    {
+        if (failed())
+        {
+            return '\0';
+        }
+        skipWhitespace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    inline bool JsonReader::atEnd()
+    {
+        return peek() == '\0' && !failed();
+    }
+
+    inline bool JsonReader::beginObject()
+    {
+        if (peek() != '{')
+        {
+            return fail("Expected an object");
+        }
+        if (depth == max_depth)
+        {
+            return fail("JSON nesting is too deep");
+        }
+        ++pos;
+        ++depth;
+        non_empty &= ~(std::uint64_t(1) << (depth - 1));
+        return true;
+    }
+
+    inline bool JsonReader::beginArray()
+    {
+        if (peek() != '[')
+        {
+            return fail("Expected an array");
+        }
+        if (depth == max_depth)
+        {
+            return fail("JSON nesting is too deep");
+        }
+        ++pos;
+        ++depth;
+        non_empty &= ~(std::uint64_t(1) << (depth - 1));
+        return true;
+    }
+
+    inline bool JsonReader::nextEntry(char close)
+    {
+        if (failed() || depth == 0)
+        {
+            return false;
+        }
+
+        const std::uint64_t bit = std::uint64_t(1) << (depth - 1);
+        char c = peek();
+        if (c == close)
+        {
+            ++pos;
+            --depth;
+            return false;
+        }
+        if (non_empty & bit)
+        {
+            if (c != ',')
+            {
+                return fail(close == '}' ? "Expected ',' or '}'" : "Expected ',' or ']'");
+            }
+            ++pos;
+            skipWhitespace();
+        }
+        non_empty |= bit;
+        return true;
+    }
+
+    inline bool JsonReader::nextKey(std::string_view &key)
+    {
+        if (!nextEntry('}'))
+        {
+            return false;
+        }
+        if (peek() != '"')
+        {
+            return fail("Expected a key");
+        }
+
+        const std::size_t start = pos;
+        if (!scanString())
+        {
+            return false;
+        }
+        key = text.substr(start + 1, pos - start - 2);
+        if (key.find('\\') != std::string_view::npos)
+        {
+            if (!detail::readQuoted(text.substr(start, pos - start), key_buffer))
+            {
+                return fail("Invalid escape sequence");
+            }
+            key = key_buffer;
+        }
+
+        if (peek() != ':')
+        {
+            return fail("Expected ':'");
+        }
+        ++pos;
+        return true;
+    }
+
+    inline bool JsonReader::nextElement()
+    {
+        return nextEntry(']');
+    }
+
+    inline bool JsonReader::scanString()
+    {
+        // pos is on the opening quote
+        for (++pos; pos < text.size(); ++pos)
+        {
+            char c = text[pos];
+            if (c == '\\')
+            {
+                ++pos;
+            }
+            else if (c == '"')
+            {
+                ++pos;
+                return true;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                return fail("Control character in string");
+            }
+        }
+        return fail("Unterminated string");
+    }
+
+    inline std::string_view JsonReader::value()
+    {
+        const char first = peek();
+        const std::size_t start = pos;
+
+        switch (first)
+        {
+        case '\0':
+            fail("Expected a value");
+            return {};
+        case '"':
+            if (!scanString())
+            {
+                return {};
+            }
+            break;
+        case '{':
+        case '[':
+        {
+            // Skip the nested value, validation is left to its consumer
+            unsigned nesting = 0;
+            while (pos < text.size())
+            {
+                char c = text[pos];
+                if (c == '"')
+                {
+                    if (!scanString())
+                    {
+                        return {};
+                    }
+                    continue;
+                }
+                ++pos;
+                if (c == '{' || c == '[')
+                {
+                    ++nesting;
+                }
+                else if (c == '}' || c == ']')
+                {
+                    if (--nesting == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            if (nesting != 0)
+            {
+                fail(first == '{' ? "Unterminated object" : "Unterminated array");
+                return {};
+            }
+            break;
+        }
+        case ',':
+        case ':':
+        case '}':
+        case ']':
+            fail("Expected a value");
+            return {};
+        default:
+            // Number or literal: read up to the next delimiter
+            while (pos < text.size())
+            {
+                char c = text[pos];
+                if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                {
+                    break;
+                }
+                ++pos;
+            }
+        }
+
+        return text.substr(start, pos - start);
+    }
+
+}
@@ -0,0 +1,136 @@
+#include <stdexcept>
+
+namespace introspection
+{
+
+    inline JsonWriter::JsonWriter(std::string &buffer, Style style) : out(buffer), mode(style) {}
+
+    inline void JsonWriter::newline()
+    {
+        out += '\n';
+        out.append(2 * depth, ' ');
+    }
+
+    inline void JsonWriter::beforeValue()
+    {
+        if (after_key)
+        {
+            after_key = false;
+            return;
+        }
+        if (depth == 0)
+        {
+            return;
+        }
+
+        const std::uint64_t bit = std::uint64_t(1) << (depth - 1);
+        if (non_empty & bit)
+        {
+            out += ',';
+        }
+        non_empty |= bit;
+        if (mode == Style::Pretty)
+        {
+            newline();
+        }
+    }
+
+    inline void JsonWriter::open(char bracket)
+    {
+        if (depth == max_depth)
+        {
+            throw std::runtime_error("JSON nesting is too deep");
+        }
+        beforeValue();
+        out += bracket;
+        ++depth;
+        non_empty &= ~(std::uint64_t(1) << (depth - 1));
+    }
+
+    inline void JsonWriter::close(char bracket)
+    {
+        const bool has_items = non_empty & (std::uint64_t(1) << (depth - 1));
+        --depth;
+        if (mode == Style::Pretty && has_items)
+        {
+            newline();
+        }
+        out += bracket;
+    }
+
+    inline JsonWriter &JsonWriter::beginObject()
+    {
+        open('{');
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::endObject()
+    {
+        close('}');
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::beginArray()
+    {
+        open('[');
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::endArray()
+    {
+        close(']');
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::key(std::string_view name)
+    {
+        beforeValue();
+        detail::appendQuoted(out, name);
+        out += mode == Style::Pretty ? ": " : ":";
+        after_key = true;
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::value(std::string_view text)
+    {
+        beforeValue();
+        detail::appendQuoted(out, text);
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::value(const char *text)
+    {
+        return value(std::string_view(text));
+    }
+
+    inline JsonWriter &JsonWriter::value(bool flag)
+    {
+        beforeValue();
+        ValueTraits<bool>::write(out, flag);
+        return *this;
+    }
+
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    inline JsonWriter &JsonWriter::value(T number)
+    {
+        beforeValue();
+        ValueTraits<T>::write(out, number);
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::value(const ValueCodec &codec, const void *data)
+    {
+        beforeValue();
+        codec.write(out, data);
+        return *this;
+    }
+
+    inline JsonWriter &JsonWriter::null()
+    {
+        beforeValue();
+        out += "null";
+        return *this;
+    }
+
+}
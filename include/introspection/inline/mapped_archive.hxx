@@ -0,0 +1,691 @@
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline constexpr std::uint32_t archive_alignment = 8;
+
+        inline std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        inline void appendPadding(std::string &out, std::size_t alignment)
+        {
+            out.resize(alignUp(out.size(), alignment), '\0');
+        }
+
+        // True if [offset, offset + size) lies within [0, limit)
+        inline bool inBounds(std::uint64_t offset, std::uint64_t size, std::uint64_t limit)
+        {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        template <typename T>
+        inline void checkArchivedType(const MemberInfo &member)
+        {
+            if (!member.holds<T>())
+            {
+                throw std::runtime_error("Type mismatch for member '" + member.name +
+                                         "' (registered as " + member.type_name + ")");
+            }
+        }
+
+        [[noreturn]] inline void malformedArchive(const std::string &what)
+        {
+            throw std::runtime_error("Malformed mapped archive: " + what);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline archive::HeapRef MappedArchiveWriter::addToHeap(std::string_view bytes)
+    {
+        archive::HeapRef ref{heap.size(), bytes.size()};
+        heap.append(bytes);
+        return ref;
+    }
+
+    inline archive::HeapRef MappedArchiveWriter::addBlobToHeap(std::string_view blob)
+    {
+        // Align the payload after the u32 length prefix on 8 bytes, so that
+        // vectors of trivially copyable types can be viewed in place
+        while (heap.size() % detail::archive_alignment != sizeof(std::uint32_t))
+        {
+            heap += '\0';
+        }
+        return addToHeap(blob);
+    }
+
+    inline void MappedArchiveWriter::add(const Introspectable &object)
+    {
+        const auto &type_info = object.getTypeInfo();
+
+        auto table = tables.begin();
+        while (table != tables.end() && table->type != &type_info)
+        {
+            ++table;
+        }
+        if (table == tables.end())
+        {
+            Table created;
+            created.type = &type_info;
+            created.codecs = detail::binaryCodecs(type_info);
+
+            std::uint32_t offset = 0;
+            for (std::size_t i = 0; i < type_info.members.size(); ++i)
+            {
+                const auto &member = type_info.members[i];
+                archive::ColumnHeader column{};
+                column.name = addToHeap(member.name);
+                column.type_name = addToHeap(member.type_name);
+
+                std::uint32_t alignment;
+                if (member.ops.trivially_copyable)
+                {
+                    if (member.ops.alignment > detail::archive_alignment)
+                    {
+                        throw std::runtime_error("Member '" + member.name + "' of class '" + type_info.class_name +
+                                                 "' is over-aligned for a mapped archive");
+                    }
+                    column.kind = archive::ColumnKind::Raw;
+                    column.size = member.ops.size;
+                    alignment = member.ops.alignment;
+                }
+                else
+                {
+                    column.kind = member.holds<std::string>() ? archive::ColumnKind::String
+                                                              : archive::ColumnKind::Blob;
+                    column.size = sizeof(archive::HeapRef);
+                    alignment = alignof(archive::HeapRef);
+                }
+                column.offset = static_cast<std::uint32_t>(detail::alignUp(offset, alignment));
+                offset = column.offset + column.size;
+                created.columns.push_back(column);
+            }
+            created.stride = static_cast<std::uint32_t>(detail::alignUp(offset, detail::archive_alignment));
+
+            tables.push_back(std::move(created));
+            table = tables.end() - 1;
+        }
+
+        const std::size_t base = table->records.size();
+        table->records.resize(base + table->stride, '\0');
+        auto *self = const_cast<Introspectable *>(&object);
+        for (std::size_t i = 0; i < type_info.members.size(); ++i)
+        {
+            const auto &member = type_info.members[i];
+            const auto &column = table->columns[i];
+            const void *value = member.address(self);
+            char *target = table->records.data() + base + column.offset;
+
+            archive::HeapRef ref;
+            switch (column.kind)
+            {
+            case archive::ColumnKind::Raw:
+                std::memcpy(target, value, column.size);
+                continue;
+            case archive::ColumnKind::String:
+                ref = addToHeap(*static_cast<const std::string *>(value));
+                break;
+            case archive::ColumnKind::Blob:
+                scratch.clear();
+                table->codecs[i]->write_binary(scratch, value);
+                ref = addBlobToHeap(scratch);
+                break;
+            }
+            std::memcpy(target, &ref, sizeof(ref));
+        }
+        ++table->record_count;
+    }
+
+    inline void MappedArchiveWriter::serialize(std::string &out) const
+    {
+        archive::FileHeader header{};
+        std::memcpy(header.magic, archive::magic, sizeof(header.magic));
+        header.version = archive::version;
+        header.table_count = static_cast<std::uint32_t>(tables.size());
+        header.tables_offset = sizeof(archive::FileHeader);
+
+        // Lay out the column tables, then the record sections, then the heap
+        std::uint64_t offset = header.tables_offset + tables.size() * sizeof(archive::TableHeader);
+        std::vector<archive::TableHeader> table_headers(tables.size());
+        for (std::size_t t = 0; t < tables.size(); ++t)
+        {
+            const auto &table = tables[t];
+            auto &table_header = table_headers[t];
+            table_header.schema_hash = table.type->schemaHash();
+            table_header.record_count = table.record_count;
+            table_header.column_count = static_cast<std::uint32_t>(table.columns.size());
+            table_header.stride = table.stride;
+            table_header.columns_offset = offset;
+            offset += table.columns.size() * sizeof(archive::ColumnHeader);
+        }
+        for (std::size_t t = 0; t < tables.size(); ++t)
+        {
+            offset = detail::alignUp(offset, detail::archive_alignment);
+            table_headers[t].records_offset = offset;
+            offset += tables[t].records.size();
+        }
+        header.heap_offset = detail::alignUp(offset, detail::archive_alignment);
+
+        std::uint64_t heap_size = heap.size();
+        for (std::size_t t = 0; t < tables.size(); ++t)
+        {
+            table_headers[t].class_name = {heap_size, tables[t].type->class_name.size()};
+            heap_size += tables[t].type->class_name.size();
+        }
+        header.heap_size = heap_size;
+        header.file_size = header.heap_offset + heap_size;
+
+        out.clear();
+        out.reserve(header.file_size);
+        detail::appendRaw(out, &header, sizeof(header));
+        detail::appendRaw(out, table_headers.data(), table_headers.size() * sizeof(archive::TableHeader));
+        for (const auto &table : tables)
+        {
+            detail::appendRaw(out, table.columns.data(), table.columns.size() * sizeof(archive::ColumnHeader));
+        }
+        for (const auto &table : tables)
+        {
+            detail::appendPadding(out, detail::archive_alignment);
+            out.append(table.records);
+        }
+        detail::appendPadding(out, detail::archive_alignment);
+        out.append(heap);
+        for (const auto &table : tables)
+        {
+            out.append(table.type->class_name);
+        }
+    }
+
+    inline void MappedArchiveWriter::save(const std::string &path) const
+    {
+        std::string bytes;
+        serialize(bytes);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+            throw std::runtime_error("Cannot write mapped archive '" + path + "'");
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline std::string RecordView::getClassName() const
+    {
+        return std::string(table->className());
+    }
+
+    inline std::vector<std::string> RecordView::getMemberNames() const
+    {
+        std::vector<std::string> names;
+        names.reserve(table->columns().size());
+        for (std::size_t i = 0; i < table->columns().size(); ++i)
+        {
+            names.emplace_back(table->columnName(i));
+        }
+        return names;
+    }
+
+    inline bool RecordView::hasMember(std::string_view name) const
+    {
+        return table->findColumn(name) < table->columns().size();
+    }
+
+    inline MemberHandle RecordView::getMemberHandle(std::string_view name) const
+    {
+        // Columns are in member registration order, so a column index is also
+        // a valid MemberHandle of the bound TypeInfo
+        const std::size_t column = table->findColumn(name);
+        if (column == table->columns().size())
+        {
+            return {};
+        }
+        return MemberHandle{static_cast<std::uint32_t>(column)};
+    }
+
+    inline const archive::ColumnHeader &RecordView::column(MemberHandle member) const
+    {
+        if (!member.valid() || member.index >= table->columns().size())
+        {
+            throw std::runtime_error("Invalid member handle for class '" + getClassName() + "'");
+        }
+        return table->columns()[member.index];
+    }
+
+    inline const std::byte *RecordView::columnData(std::size_t column) const
+    {
+        return record + table->columns()[column].offset;
+    }
+
+    inline std::string_view RecordView::heapBytes(std::size_t column) const
+    {
+        archive::HeapRef ref;
+        std::memcpy(&ref, columnData(column), sizeof(ref));
+        const auto heap = table->heap();
+        if (!detail::inBounds(ref.offset, ref.size, heap.size()))
+        {
+            detail::malformedArchive("value of member '" + std::string(table->columnName(column)) +
+                                     "' is out of the heap");
+        }
+        return heap.substr(ref.offset, ref.size);
+    }
+
+    inline std::any RecordView::getMemberValue(std::string_view name) const
+    {
+        MemberHandle member = getMemberHandle(name);
+        if (!member)
+        {
+            throw std::runtime_error("Member '" + std::string(name) + "' not found in class '" + getClassName() + "'");
+        }
+        return getMemberValue(member);
+    }
+
+    inline std::any RecordView::getMemberValue(MemberHandle member) const
+    {
+        const auto &col = column(member);
+        if (col.kind == archive::ColumnKind::String)
+        {
+            return std::string(heapBytes(member.index));
+        }
+
+        const TypeInfo *type = table->typeInfo();
+        if (!type)
+        {
+            throw std::runtime_error("Table '" + getClassName() + "' is not bound to a TypeInfo");
+        }
+        const auto &info = type->memberAt(member);
+        const auto *codec = info.codec();
+        if (!codec)
+        {
+            throw std::runtime_error("Member '" + info.name + "' has no codec (type " + info.type_name + ")");
+        }
+
+        std::any box;
+        void *value = codec->emplace(box);
+        if (col.kind == archive::ColumnKind::Raw)
+        {
+            std::memcpy(value, columnData(member.index), col.size);
+        }
+        else
+        {
+            auto in = heapBytes(member.index);
+            if (!codec->read_binary || !codec->read_binary(in, value))
+            {
+                detail::malformedArchive("cannot decode member '" + info.name + "'");
+            }
+        }
+        return box;
+    }
+
+    template <typename T>
+    inline const T &RecordView::getMemberRef(MemberHandle member) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable members are stored in place");
+        const auto &col = column(member);
+        const TypeInfo *type = table->typeInfo();
+        if (!type)
+        {
+            throw std::runtime_error("Table '" + getClassName() + "' is not bound to a TypeInfo");
+        }
+        detail::checkArchivedType<T>(type->memberAt(member));
+        if (col.kind != archive::ColumnKind::Raw)
+        {
+            throw std::runtime_error("Member '" + std::string(table->columnName(member.index)) + "' is not stored in place");
+        }
+        return *reinterpret_cast<const T *>(columnData(member.index));
+    }
+
+    inline std::string_view RecordView::getString(MemberHandle member) const
+    {
+        if (column(member).kind != archive::ColumnKind::String)
+        {
+            throw std::runtime_error("Member '" + std::string(table->columnName(member.index)) + "' is not a string");
+        }
+        return heapBytes(member.index);
+    }
+
+    template <typename T>
+    inline std::span<const T> RecordView::getSpan(MemberHandle member) const
+    {
+        static_assert(std::is_trivially_copyable_v<T> && !detail::HasBinaryTraits<T> &&
+                          alignof(T) <= detail::archive_alignment,
+                      "Only vectors of trivially copyable elements can be viewed in place");
+        const auto &col = column(member);
+        const TypeInfo *type = table->typeInfo();
+        if (!type)
+        {
+            throw std::runtime_error("Table '" + getClassName() + "' is not bound to a TypeInfo");
+        }
+        detail::checkArchivedType<std::vector<T>>(type->memberAt(member));
+        if (col.kind != archive::ColumnKind::Blob)
+        {
+            throw std::runtime_error("Member '" + std::string(table->columnName(member.index)) + "' is not a blob");
+        }
+
+        auto bytes = heapBytes(member.index);
+        std::uint32_t count;
+        if (!detail::readRaw(bytes, &count, sizeof(count)) || bytes.size() != std::uint64_t(count) * sizeof(T))
+        {
+            detail::malformedArchive("cannot view member '" + std::string(table->columnName(member.index)) + "'");
+        }
+        return {reinterpret_cast<const T *>(bytes.data()), count};
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline std::string_view MappedTable::className() const
+    {
+        return heap_bytes.substr(header->class_name.offset, header->class_name.size);
+    }
+
+    inline RecordView MappedTable::operator[](std::size_t index) const
+    {
+        // Unchecked, like std::vector::operator[]
+        return RecordView(*this, records + index * header->stride);
+    }
+
+    inline std::string_view MappedTable::columnName(std::size_t column) const
+    {
+        const auto &ref = column_headers[column].name;
+        return heap_bytes.substr(ref.offset, ref.size);
+    }
+
+    inline std::string_view MappedTable::columnTypeName(std::size_t column) const
+    {
+        const auto &ref = column_headers[column].type_name;
+        return heap_bytes.substr(ref.offset, ref.size);
+    }
+
+    inline std::size_t MappedTable::findColumn(std::string_view name) const
+    {
+        if (type)
+        {
+            MemberHandle member = type->findMember(name);
+            return member ? member.index : column_headers.size();
+        }
+        for (std::size_t i = 0; i < column_headers.size(); ++i)
+        {
+            if (columnName(i) == name)
+            {
+                return i;
+            }
+        }
+        return column_headers.size();
+    }
+
+    inline bool MappedTable::bind(const TypeInfo &type_info)
+    {
+        if (className() != type_info.class_name || schemaHash() != type_info.schemaHash() ||
+            column_headers.size() != type_info.members.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < column_headers.size(); ++i)
+        {
+            const auto &member = type_info.members[i];
+            const auto kind = column_headers[i].kind;
+            if (member.ops.trivially_copyable ? kind != archive::ColumnKind::Raw || column_headers[i].size != member.ops.size
+                                              : kind == archive::ColumnKind::Raw)
+            {
+                return false;
+            }
+        }
+        type = &type_info;
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline MappedArchive::MappedArchive(const std::string &path)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Cannot open mapped archive '" + path + "'");
+        }
+        file_handle = file;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            unmap();
+            throw std::runtime_error("Cannot stat mapped archive '" + path + "'");
+        }
+        size = static_cast<std::size_t>(file_size.QuadPart);
+        if (size >= sizeof(archive::FileHeader))
+        {
+            mapping_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_handle)
+            {
+                data = static_cast<const std::byte *>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+            }
+        }
+#else
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            throw std::runtime_error("Cannot open mapped archive '" + path + "'");
+        }
+        struct stat status;
+        if (::fstat(file, &status) != 0)
+        {
+            ::close(file);
+            throw std::runtime_error("Cannot stat mapped archive '" + path + "'");
+        }
+        size = static_cast<std::size_t>(status.st_size);
+        if (size >= sizeof(archive::FileHeader))
+        {
+            void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapping != MAP_FAILED)
+            {
+                data = static_cast<const std::byte *>(mapping);
+            }
+        }
+        ::close(file); // The mapping keeps the file alive
+#endif
+        if (!data)
+        {
+            const bool too_small = size < sizeof(archive::FileHeader);
+            unmap();
+            throw std::runtime_error(too_small ? "Not a mapped archive: '" + path + "'"
+                                               : "Cannot map archive '" + path + "'");
+        }
+
+        try
+        {
+            parse();
+        }
+        catch (...)
+        {
+            unmap();
+            throw;
+        }
+    }
+
+    inline MappedArchive::~MappedArchive()
+    {
+        unmap();
+    }
+
+    inline MappedArchive::MappedArchive(MappedArchive &&other) noexcept
+        : data(other.data), size(other.size),
+#if defined(_WIN32)
+          file_handle(other.file_handle), mapping_handle(other.mapping_handle),
+#endif
+          table_views(std::move(other.table_views))
+    {
+        other.data = nullptr;
+        other.size = 0;
+#if defined(_WIN32)
+        other.file_handle = other.mapping_handle = nullptr;
+#endif
+        other.table_views.clear();
+    }
+
+    inline MappedArchive &MappedArchive::operator=(MappedArchive &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+#if defined(_WIN32)
+            file_handle = std::exchange(other.file_handle, nullptr);
+            mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+            table_views = std::move(other.table_views);
+            other.table_views.clear();
+        }
+        return *this;
+    }
+
+    inline void MappedArchive::unmap()
+    {
+#if defined(_WIN32)
+        if (data)
+            UnmapViewOfFile(data);
+        if (mapping_handle)
+            CloseHandle(mapping_handle);
+        if (file_handle)
+            CloseHandle(file_handle);
+        file_handle = mapping_handle = nullptr;
+#else
+        if (data)
+            ::munmap(const_cast<std::byte *>(data), size);
+#endif
+        data = nullptr;
+        size = 0;
+        table_views.clear();
+    }
+
+    inline void MappedArchive::parse()
+    {
+        // Only the schema tables are read: records stay untouched until accessed
+        archive::FileHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, archive::magic, sizeof(header.magic)) != 0)
+        {
+            throw std::runtime_error("Not a mapped archive");
+        }
+        if (header.version != archive::version)
+        {
+            throw std::runtime_error("Unsupported mapped archive version " + std::to_string(header.version));
+        }
+        if (header.file_size != size)
+        {
+            detail::malformedArchive("file size mismatch (truncated file?)");
+        }
+        if (!detail::inBounds(header.heap_offset, header.heap_size, size))
+        {
+            detail::malformedArchive("heap is out of the file");
+        }
+        if (header.tables_offset % detail::archive_alignment != 0 ||
+            !detail::inBounds(header.tables_offset, std::uint64_t(header.table_count) * sizeof(archive::TableHeader), size))
+        {
+            detail::malformedArchive("table headers are out of the file");
+        }
+
+        const std::string_view heap(reinterpret_cast<const char *>(data) + header.heap_offset, header.heap_size);
+        auto headers = reinterpret_cast<const archive::TableHeader *>(data + header.tables_offset);
+        table_views.resize(header.table_count);
+        for (std::uint32_t t = 0; t < header.table_count; ++t)
+        {
+            const auto &table_header = headers[t];
+            if (!detail::inBounds(table_header.class_name.offset, table_header.class_name.size, heap.size()))
+            {
+                detail::malformedArchive("class name is out of the heap");
+            }
+            if (table_header.columns_offset % detail::archive_alignment != 0 ||
+                !detail::inBounds(table_header.columns_offset,
+                                  std::uint64_t(table_header.column_count) * sizeof(archive::ColumnHeader), size))
+            {
+                detail::malformedArchive("column headers are out of the file");
+            }
+            if (table_header.stride % detail::archive_alignment != 0 ||
+                table_header.records_offset % detail::archive_alignment != 0 ||
+                (table_header.stride != 0 && table_header.record_count > size / table_header.stride) ||
+                !detail::inBounds(table_header.records_offset, table_header.record_count * table_header.stride, size))
+            {
+                detail::malformedArchive("records are out of the file");
+            }
+
+            auto &view = table_views[t];
+            view.header = &table_header;
+            view.column_headers = {reinterpret_cast<const archive::ColumnHeader *>(data + table_header.columns_offset),
+                                   table_header.column_count};
+            view.records = data + table_header.records_offset;
+            view.heap_bytes = heap;
+
+            for (const auto &column : view.column_headers)
+            {
+                const bool valid_kind = column.kind == archive::ColumnKind::Raw ||
+                                        ((column.kind == archive::ColumnKind::String ||
+                                          column.kind == archive::ColumnKind::Blob) &&
+                                         column.size == sizeof(archive::HeapRef) &&
+                                         column.offset % alignof(archive::HeapRef) == 0);
+                if (!valid_kind || !detail::inBounds(column.offset, column.size, table_header.stride) ||
+                    !detail::inBounds(column.name.offset, column.name.size, heap.size()) ||
+                    !detail::inBounds(column.type_name.offset, column.type_name.size, heap.size()))
+                {
+                    detail::malformedArchive("invalid column in table '" + std::string(view.className()) + "'");
+                }
+            }
+        }
+    }
+
+    inline const MappedTable *MappedArchive::find(std::string_view class_name) const
+    {
+        for (const auto &table : table_views)
+        {
+            if (table.className() == class_name)
+            {
+                return &table;
+            }
+        }
+        return nullptr;
+    }
+
+    inline const MappedTable &MappedArchive::table(const TypeInfo &type_info)
+    {
+        for (auto &table : table_views)
+        {
+            if (table.className() != type_info.class_name)
+            {
+                continue;
+            }
+            if (table.typeInfo() != &type_info && !table.bind(type_info))
+            {
+                throw std::runtime_error("Schema mismatch: archive table '" + type_info.class_name +
+                                         "' differs from the registered class");
+            }
+            return table;
+        }
+        throw std::runtime_error("Archive has no table for class '" + type_info.class_name + "'");
+    }
+
+}
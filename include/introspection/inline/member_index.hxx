@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        // Call visit(const MemberInfo &) for `members`, every member when empty
+        template <typename F>
+        inline void forMembers(const TypeInfo &type_info, std::span<const MemberHandle> members, F &&visit)
+        {
+            if (members.empty())
+            {
+                for (const auto &member : type_info.members)
+                {
+                    visit(member);
+                }
+                return;
+            }
+            for (auto handle : members)
+            {
+                visit(type_info.memberAt(handle));
+            }
+        }
+
+        inline MemberHandle indexedMember(const TypeInfo &type_info, std::string_view member)
+        {
+            MemberHandle handle = type_info.findMember(member);
+            if (!handle)
+            {
+                throw std::runtime_error("Member '" + std::string(member) + "' not found");
+            }
+            return handle;
+        }
+    }
+
+    inline std::size_t hashMembers(const Introspectable &object, std::span<const MemberHandle> members)
+    {
+        auto *self = const_cast<Introspectable *>(&object);
+        std::size_t seed = 0;
+        detail::forMembers(object.getTypeInfo(), members, [&](const MemberInfo &member)
+                           {
+            if (!member.ops.hash)
+            {
+                throw std::runtime_error("Member '" + member.name + "' is not hashable");
+            }
+            seed = detail::hashCombine(seed, member.ops.hash(member.address(self))); });
+        return seed;
+    }
+
+    inline bool equalMembers(const Introspectable &a, const Introspectable &b, std::span<const MemberHandle> members)
+    {
+        const auto &type_info = a.getTypeInfo();
+        if (&type_info != &b.getTypeInfo())
+        {
+            return false;
+        }
+        auto *left = const_cast<Introspectable *>(&a);
+        auto *right = const_cast<Introspectable *>(&b);
+        bool equal = true;
+        detail::forMembers(type_info, members, [&](const MemberInfo &member)
+                           {
+            if (!member.ops.equals)
+            {
+                throw std::runtime_error("Member '" + member.name + "' has no operator==");
+            }
+            equal = equal && member.ops.equals(member.address(left), member.address(right)); });
+        return equal;
+    }
+
+    // ----------------------------------------------------------------
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::Entry::memberChanged(MemberHandle member)
+    {
+        // An invalid handle comes from markAll()
+        if ((member.index == index->key_member.index || !member.valid()) &&
+            !queued.exchange(true, std::memory_order_acq_rel))
+        {
+            index->enqueue(this);
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline MemberIndex<T, K, Order>::MemberIndex(MemberHandle member) : key_member(member)
+    {
+        const auto &info = T::getStaticTypeInfo().memberAt(member);
+        if (!info.template holds<K>())
+        {
+            throw std::runtime_error("Cannot index member '" + info.name + "' (registered as " + info.type_name +
+                                     ") by another type");
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline MemberIndex<T, K, Order>::MemberIndex(std::string_view member)
+        : MemberIndex(detail::indexedMember(T::getStaticTypeInfo(), member))
+    {
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline MemberIndex<T, K, Order>::~MemberIndex()
+    {
+        for (auto &[object, entry] : entries)
+        {
+            if (entry->changes)
+            {
+                entry->changes->unlisten(entry.get());
+            }
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline const K &MemberIndex<T, K, Order>::currentKey(const T &object) const
+    {
+        return object.template getMemberRef<K>(key_member);
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::insert(T &object)
+    {
+        if (entries.contains(&object))
+        {
+            update(object);
+            return;
+        }
+        auto entry = std::make_unique<Entry>();
+        entry->index = this;
+        entry->object = &object;
+        entry->key = currentKey(object);
+        if (auto *changes = object.changeSet())
+        {
+            if (!changes->listen(entry.get()))
+            {
+                throw std::runtime_error("Cannot index object: its change set has no free listener slot");
+            }
+            entry->changes = changes;
+        }
+        keys.emplace(entry->key, entry.get());
+        entries.emplace(&object, std::move(entry));
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::insert(std::span<T> objects)
+    {
+        entries.reserve(entries.size() + objects.size());
+        if constexpr (Order == IndexOrder::Hashed)
+        {
+            keys.reserve(keys.size() + objects.size());
+        }
+        for (auto &object : objects)
+        {
+            insert(object);
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::erase(T &object)
+    {
+        auto it = entries.find(&object);
+        if (it == entries.end())
+        {
+            return;
+        }
+        Entry &entry = *it->second;
+        if (entry.changes)
+        {
+            entry.changes->unlisten(&entry);
+        }
+        {
+            std::lock_guard lock(queue_mutex);
+            std::erase(queue, &entry);
+        }
+        unlink(entry);
+        entries.erase(it);
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::update(T &object)
+    {
+        auto it = entries.find(&object);
+        if (it != entries.end())
+        {
+            rekey(*it->second);
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::refresh()
+    {
+        std::vector<Entry *> ready;
+        {
+            std::lock_guard lock(queue_mutex);
+            if (queue.empty())
+            {
+                return;
+            }
+            ready.swap(queue);
+        }
+        for (Entry *entry : ready)
+        {
+            // Cleared first: a write from now on queues the object again
+            entry->queued.store(false, std::memory_order_release);
+            rekey(*entry);
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::rekey(Entry &entry)
+    {
+        const K &key = currentKey(*entry.object);
+        if (key == entry.key)
+        {
+            return;
+        }
+        unlink(entry);
+        entry.key = key;
+        keys.emplace(entry.key, &entry);
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::unlink(Entry &entry)
+    {
+        auto [first, last] = keys.equal_range(entry.key);
+        for (auto it = first; it != last; ++it)
+        {
+            if (it->second == &entry)
+            {
+                keys.erase(it);
+                return;
+            }
+        }
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline void MemberIndex<T, K, Order>::enqueue(Entry *entry)
+    {
+        std::lock_guard lock(queue_mutex);
+        queue.push_back(entry);
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline T *MemberIndex<T, K, Order>::find(const K &key)
+    {
+        refresh();
+        auto it = keys.find(key);
+        return it != keys.end() ? it->second->object : nullptr;
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline std::vector<T *> MemberIndex<T, K, Order>::findAll(const K &key)
+    {
+        refresh();
+        std::vector<T *> found;
+        auto [first, last] = keys.equal_range(key);
+        for (auto it = first; it != last; ++it)
+        {
+            found.push_back(it->second->object);
+        }
+        return found;
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline std::size_t MemberIndex<T, K, Order>::count(const K &key)
+    {
+        refresh();
+        return keys.count(key);
+    }
+
+    template <typename T, typename K, IndexOrder Order>
+    inline std::vector<T *> MemberIndex<T, K, Order>::range(const K &low, const K &high)
+        requires(Order == IndexOrder::Sorted)
+    {
+        refresh();
+        std::vector<T *> found;
+        if (!(low < high))
+        {
+            return found;
+        }
+        for (auto it = keys.lower_bound(low), last = keys.lower_bound(high); it != last; ++it)
+        {
+            found.push_back(it->second->object);
+        }
+        return found;
+    }
+
+}
@@ -0,0 +1,216 @@
+#include <any>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline constexpr char patch_magic[4] = {'I', 'P', 'T', '1'};
+
+        inline void patchTruncated()
+        {
+            throw std::runtime_error("Truncated patch");
+        }
+
+        inline std::string binaryEncoding(const ValueCodec &codec, const void *value)
+        {
+            std::string encoding;
+            codec.write_binary(encoding, value);
+            return encoding;
+        }
+
+        inline bool memberEquals(const MemberInfo &member, const void *a, const void *b)
+        {
+            if (member.ops.equals)
+            {
+                return member.ops.equals(a, b);
+            }
+            if (member.ops.trivially_copyable)
+            {
+                return std::memcmp(a, b, member.ops.size) == 0;
+            }
+            const auto *codec = member.codec();
+            if (codec && codec->write_binary)
+            {
+                return binaryEncoding(*codec, a) == binaryEncoding(*codec, b);
+            }
+            throw std::runtime_error("Member '" + member.name + "' of type " + member.type_name +
+                                     " cannot be compared");
+        }
+
+        inline const TypeInfo &commonClass(const Introspectable &from, const Introspectable &to)
+        {
+            const auto &type_info = from.getTypeInfo();
+            if (&to.getTypeInfo() != &type_info)
+            {
+                throw std::runtime_error("Cannot diff '" + type_info.class_name + "' against '" +
+                                         to.getTypeInfo().class_name + "'");
+            }
+            return type_info;
+        }
+    }
+
+    inline std::vector<MemberHandle> diff(const Introspectable &from, const Introspectable &to)
+    {
+        const auto &type_info = detail::commonClass(from, to);
+        auto *a = const_cast<Introspectable *>(&from);
+        auto *b = const_cast<Introspectable *>(&to);
+
+        std::vector<MemberHandle> changed;
+        for (std::size_t i = 0; i < type_info.members.size(); ++i)
+        {
+            const auto &member = type_info.members[i];
+            if (!detail::memberEquals(member, member.address(a), member.address(b)))
+            {
+                changed.push_back(MemberHandle{static_cast<std::uint32_t>(i)});
+            }
+        }
+        return changed;
+    }
+
+    inline void writePatch(std::string &out, const Introspectable &object, std::span<const MemberHandle> members)
+    {
+        const auto &type_info = object.getTypeInfo();
+        const auto codecs = detail::binaryCodecs(type_info);
+        auto *self = const_cast<Introspectable *>(&object);
+        for (auto handle : members)
+        {
+            type_info.memberAt(handle); // Throws before anything is appended
+        }
+
+        out.append(detail::patch_magic, sizeof(detail::patch_magic));
+        const std::uint64_t hash = type_info.schemaHash();
+        detail::appendRaw(out, &hash, sizeof(hash));
+        const auto count = static_cast<std::uint32_t>(members.size());
+        detail::appendRaw(out, &count, sizeof(count));
+
+        for (auto handle : members)
+        {
+            const auto &member = type_info.memberAt(handle);
+            detail::appendRaw(out, &handle.index, sizeof(handle.index));
+            const void *value = member.address(self);
+            if (codecs[handle.index])
+                codecs[handle.index]->write_binary(out, value);
+            else
+                detail::appendRaw(out, value, member.ops.size);
+        }
+    }
+
+    inline std::size_t writePatch(std::string &out, const Introspectable &from, const Introspectable &to)
+    {
+        const auto changed = diff(from, to);
+        writePatch(out, to, changed);
+        return changed.size();
+    }
+
+    inline std::size_t applyPatch(Introspectable &object, std::string_view patch)
+    {
+        const auto &type_info = object.getTypeInfo();
+
+        char magic[sizeof(detail::patch_magic)];
+        if (!detail::readRaw(patch, magic, sizeof(magic)) ||
+            std::string_view(magic, sizeof(magic)) != std::string_view(detail::patch_magic, sizeof(magic)))
+        {
+            throw std::runtime_error("Not a patch");
+        }
+        std::uint64_t hash;
+        std::uint32_t count;
+        if (!detail::readRaw(patch, &hash, sizeof(hash)) || !detail::readRaw(patch, &count, sizeof(count)))
+        {
+            detail::patchTruncated();
+        }
+        if (hash != type_info.schemaHash())
+        {
+            throw std::runtime_error("Schema mismatch: the patch was not made for '" + type_info.class_name + "'");
+        }
+
+        // Decode everything first: raw values stay in the patch bytes, the
+        // others are decoded into boxes
+        struct Entry
+        {
+            std::uint32_t index;
+            const char *raw;
+            std::any value;
+        };
+        // Each entry starts with its member index: a larger count cannot be
+        // honest, and must not size the reservation
+        if (count > patch.size() / sizeof(std::uint32_t))
+        {
+            detail::patchTruncated();
+        }
+        const auto codecs = detail::binaryCodecs(type_info);
+        std::vector<Entry> entries;
+        entries.reserve(count);
+        for (std::uint32_t k = 0; k < count; ++k)
+        {
+            Entry entry{0, nullptr, {}};
+            if (!detail::readRaw(patch, &entry.index, sizeof(entry.index)))
+            {
+                detail::patchTruncated();
+            }
+            if (entry.index >= type_info.members.size())
+            {
+                throw std::runtime_error("Invalid member index in patch for '" + type_info.class_name + "'");
+            }
+            const auto &member = type_info.members[entry.index];
+            if (const auto *codec = codecs[entry.index])
+            {
+                if (!member.ops.copy_assign || !codec->read_binary(patch, codec->emplace(entry.value)))
+                {
+                    detail::patchTruncated();
+                }
+            }
+            else
+            {
+                if (patch.size() < member.ops.size)
+                {
+                    detail::patchTruncated();
+                }
+                entry.raw = patch.data();
+                patch.remove_prefix(member.ops.size);
+            }
+            entries.push_back(std::move(entry));
+        }
+
+        for (const auto &entry : entries)
+        {
+            const auto &member = type_info.members[entry.index];
+            void *address = member.address(&object);
+            if (entry.raw)
+                std::memcpy(address, entry.raw, member.ops.size);
+            else
+                member.ops.copy_assign(address, codecs[entry.index]->unbox(entry.value));
+            object.markChanged(MemberHandle{entry.index});
+        }
+        return entries.size();
+    }
+
+    inline void writeJsonPatch(JsonWriter &json, const Introspectable &object, std::span<const MemberHandle> members)
+    {
+        const auto &type_info = object.getTypeInfo();
+        auto *self = const_cast<Introspectable *>(&object);
+
+        json.beginObject();
+        for (auto handle : members)
+        {
+            const auto &member = type_info.memberAt(handle);
+            json.key(member.name);
+            if (const auto *codec = member.codec())
+                json.value(*codec, member.address(self));
+            else
+                json.null();
+        }
+        json.endObject();
+    }
+
+    inline std::size_t writeJsonPatch(JsonWriter &json, const Introspectable &from, const Introspectable &to)
+    {
+        const auto changed = diff(from, to);
+        writeJsonPatch(json, to, changed);
+        return changed.size();
+    }
+
+}
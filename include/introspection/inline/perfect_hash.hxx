@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace introspection
+{
+
+    inline std::uint64_t PerfectHashIndex::mix(std::uint64_t hash, std::uint32_t displacement)
+    {
+        // splitmix64 finalizer
+        std::uint64_t x = hash ^ (displacement * 0x9e3779b97f4a7c15ull);
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    inline void PerfectHashIndex::build(const std::vector<std::string_view> &keys)
+    {
+        displacements.clear();
+        slots.clear();
+        bucket_mask = slot_mask = 0;
+        if (keys.empty())
+        {
+            return;
+        }
+
+        std::vector<std::uint64_t> hashes(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            hashes[i] = detail::fnv1a(keys[i]);
+        }
+
+        const std::size_t bucket_count = std::bit_ceil(std::max<std::size_t>(1, keys.size() / 4));
+        std::size_t slot_count = std::bit_ceil(keys.size() * 2);
+
+        // Group keys by bucket, largest buckets are placed first
+        std::vector<std::vector<std::uint32_t>> buckets(bucket_count);
+        for (std::uint32_t i = 0; i < keys.size(); ++i)
+        {
+            buckets[(hashes[i] >> 32) & (bucket_count - 1)].push_back(i);
+        }
+        std::vector<std::uint32_t> order(bucket_count);
+        for (std::uint32_t b = 0; b < bucket_count; ++b)
+        {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](std::uint32_t a, std::uint32_t b)
+                         { return buckets[a].size() > buckets[b].size(); });
+
+        constexpr std::uint32_t max_displacement = 1u << 16;
+        std::vector<std::uint64_t> candidate;
+        for (int attempt = 0; attempt < 8; ++attempt, slot_count *= 2)
+        {
+            displacements.assign(bucket_count, 0);
+            slots.assign(slot_count, npos);
+            bool placed_all = true;
+
+            for (std::uint32_t b : order)
+            {
+                const auto &bucket = buckets[b];
+                if (bucket.empty())
+                {
+                    break;
+                }
+
+                bool placed = false;
+                for (std::uint32_t d = 0; d < max_displacement && !placed; ++d)
+                {
+                    candidate.clear();
+                    placed = true;
+                    for (std::uint32_t key : bucket)
+                    {
+                        std::uint64_t slot = mix(hashes[key], d) & (slot_count - 1);
+                        if (slots[slot] != npos ||
+                            std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        candidate.push_back(slot);
+                    }
+                    if (placed)
+                    {
+                        displacements[b] = d;
+                        for (std::size_t k = 0; k < bucket.size(); ++k)
+                        {
+                            slots[candidate[k]] = bucket[k];
+                        }
+                    }
+                }
+
+                if (!placed)
+                {
+                    placed_all = false;
+                    break;
+                }
+            }
+
+            if (placed_all)
+            {
+                bucket_mask = bucket_count - 1;
+                slot_mask = slot_count - 1;
+                return;
+            }
+        }
+
+        throw std::runtime_error("Unable to build a perfect hash index");
+    }
+
+    template <typename KeyAt>
+    inline std::uint32_t PerfectHashIndex::find(std::string_view key, KeyAt &&key_at) const
+    {
+        if (slots.empty())
+        {
+            return npos;
+        }
+        const std::uint64_t hash = detail::fnv1a(key);
+        const std::uint32_t index = slots[mix(hash, displacements[(hash >> 32) & bucket_mask]) & slot_mask];
+        return (index != npos && key_at(index) == key) ? index : npos;
+    }
+
+    inline std::size_t PerfectHashIndex::memoryBytes() const
+    {
+        return (displacements.capacity() + slots.capacity()) * sizeof(std::uint32_t);
+    }
+
+}
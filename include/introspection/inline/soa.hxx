@@ -0,0 +1,390 @@
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        // Call f(std::integral_constant<std::size_t, I>{}) for I in [0, N)
+        template <std::size_t N, typename F>
+        constexpr void forEachIndex(F &&f)
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            { (f(std::integral_constant<std::size_t, I>{}), ...); }(std::make_index_sequence<N>{});
+        }
+
+        template <typename T>
+        inline SoAColumn<T>::SoAColumn(const SoAColumn &other)
+        {
+            reserve(other.count);
+            try
+            {
+                std::uninitialized_copy_n(other.items, other.count, items);
+            }
+            catch (...)
+            {
+                // No destructor runs for a throwing constructor
+                ::operator delete(items, std::align_val_t{alignment});
+                throw;
+            }
+            count = other.count;
+        }
+
+        template <typename T>
+        inline SoAColumn<T>::SoAColumn(SoAColumn &&other) noexcept
+            : items(std::exchange(other.items, nullptr)),
+              count(std::exchange(other.count, 0)),
+              capacity(std::exchange(other.capacity, 0))
+        {
+        }
+
+        template <typename T>
+        inline SoAColumn<T> &SoAColumn<T>::operator=(SoAColumn other) noexcept
+        {
+            std::swap(items, other.items);
+            std::swap(count, other.count);
+            std::swap(capacity, other.capacity);
+            return *this;
+        }
+
+        template <typename T>
+        inline SoAColumn<T>::~SoAColumn()
+        {
+            clear();
+            ::operator delete(items, std::align_val_t{alignment});
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::reserve(std::size_t new_capacity)
+        {
+            if (new_capacity <= capacity)
+            {
+                return;
+            }
+            auto *storage = static_cast<T *>(::operator new(new_capacity * sizeof(T), std::align_val_t{alignment}));
+            if constexpr (std::is_nothrow_move_constructible_v<T>)
+            {
+                std::uninitialized_move_n(items, count, storage);
+            }
+            else
+            {
+                try
+                {
+                    std::uninitialized_copy_n(items, count, storage);
+                }
+                catch (...)
+                {
+                    ::operator delete(storage, std::align_val_t{alignment});
+                    throw;
+                }
+            }
+            std::destroy_n(items, count);
+            ::operator delete(items, std::align_val_t{alignment});
+            items = storage;
+            capacity = new_capacity;
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::grow()
+        {
+            reserve(capacity == 0 ? 16 : capacity * 2);
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::resize(std::size_t new_size)
+        {
+            if (new_size < count)
+            {
+                std::destroy(items + new_size, items + count);
+            }
+            else if (new_size > count)
+            {
+                reserve(new_size);
+                std::uninitialized_value_construct(items + count, items + new_size);
+            }
+            count = new_size;
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::push_back(const T &value)
+        {
+            if (count == capacity)
+            {
+                if (&value >= items && &value < items + count)
+                {
+                    // Aliases our storage, which is about to move
+                    T copy(value);
+                    grow();
+                    ::new (static_cast<void *>(items + count)) T(std::move(copy));
+                    ++count;
+                    return;
+                }
+                grow();
+            }
+            ::new (static_cast<void *>(items + count)) T(value);
+            ++count;
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::pop_back()
+        {
+            std::destroy_at(items + --count);
+        }
+
+        template <typename T>
+        inline void SoAColumn<T>::clear()
+        {
+            std::destroy_n(items, count);
+            count = 0;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::reserve(std::size_t capacity)
+    {
+        std::apply([capacity](auto &...column)
+                   { (column.reserve(capacity), ...); },
+                   columns);
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::resize(std::size_t new_size)
+    {
+        const std::size_t old_size = size();
+        std::size_t resized = 0;
+        try
+        {
+            detail::forEachIndex<column_count>([&](auto i)
+                                               {
+                std::get<i>(columns).resize(new_size);
+                ++resized; });
+        }
+        catch (...)
+        {
+            restoreSize(old_size, resized);
+            throw;
+        }
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::clear()
+    {
+        std::apply([](auto &...column)
+                   { (column.clear(), ...); },
+                   columns);
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::push_back(const T &object)
+    {
+        const std::size_t old_size = size();
+        std::size_t pushed = 0;
+        try
+        {
+            detail::forEachIndex<column_count>([&](auto i)
+                                               {
+                constexpr auto field = std::get<i>(T::staticFields());
+                std::get<i>(columns).push_back(object.*field.pointer);
+                ++pushed; });
+        }
+        catch (...)
+        {
+            restoreSize(old_size, pushed);
+            throw;
+        }
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::restoreSize(std::size_t old_size, std::size_t changed_columns)
+    {
+        // Each column operation has the strong guarantee: only the columns
+        // before the throwing one changed. Shrinking back only destroys
+        detail::forEachIndex<column_count>([&](auto i)
+                                           {
+            if (i < changed_columns)
+                std::get<i>(columns).resize(old_size); });
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::pop_back()
+    {
+        std::apply([](auto &...column)
+                   { (column.pop_back(), ...); },
+                   columns);
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline T SoAVector<T>::get(std::size_t index) const
+    {
+        T object;
+        detail::forEachIndex<column_count>([&](auto i)
+                                           {
+            constexpr auto field = std::get<i>(T::staticFields());
+            object.*field.pointer = std::get<i>(columns)[index]; });
+        return object;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::set(std::size_t index, const T &object)
+    {
+        // Copies first; moving them in then only throws for fields whose move assignment does
+        auto values = [&]<std::size_t... I>(std::index_sequence<I...>)
+        { return std::tuple{object.*std::get<I>(T::staticFields()).pointer...}; }(std::make_index_sequence<column_count>{});
+        detail::forEachIndex<column_count>([&](auto i)
+                                           { std::get<i>(columns)[index] = std::move(std::get<i>(values)); });
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline std::size_t SoAVector<T>::columnOf(MemberHandle member)
+    {
+        // Member index -> descriptor index, resolved once per type
+        static const std::vector<std::size_t> column_of_member = []
+        {
+            const auto &type_info = typeInfo();
+            std::vector<std::size_t> result(type_info.members.size(), npos);
+            detail::forEachIndex<column_count>([&](auto i)
+                                               {
+                constexpr auto field = std::get<i>(T::staticFields());
+                using Member = typename decltype(field)::value_type;
+                MemberHandle handle = type_info.findMember(field.name);
+                if (!handle || !type_info.memberAt(handle).template holds<Member>())
+                {
+                    throw std::runtime_error("Field '" + std::string(field.name) + "' of the descriptor of '" +
+                                             type_info.class_name + "' is not a registered member");
+                }
+                result[handle.index] = i; });
+            return result;
+        }();
+
+        return member.valid() && member.index < column_of_member.size() ? column_of_member[member.index] : npos;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline MemberHandle SoAVector<T>::handleOf(std::string_view member)
+    {
+        MemberHandle handle = typeInfo().findMember(member);
+        if (!handle)
+        {
+            throw std::runtime_error("Member '" + std::string(member) + "' not found");
+        }
+        return handle;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline std::size_t SoAVector<T>::storedColumn(MemberHandle member)
+    {
+        const std::size_t column = columnOf(member);
+        if (column == npos)
+        {
+            throw std::runtime_error("Member is not stored in the SoAVector of '" + typeInfo().class_name + "'");
+        }
+        return column;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    template <typename M>
+    inline std::size_t SoAVector<T>::checkedColumn(MemberHandle member)
+    {
+        const std::size_t column = storedColumn(member);
+        const auto &info = typeInfo().memberAt(member);
+        if (!info.template holds<M>())
+        {
+            throw std::runtime_error("Type mismatch for member '" + info.name + "' (registered as " + info.type_name + ")");
+        }
+        return column;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline const void *SoAVector<T>::columnData(std::size_t column) const
+    {
+        const void *data = nullptr;
+        detail::forEachIndex<column_count>([&](auto i)
+                                           {
+            if (i == column)
+                data = std::get<i>(columns).data(); });
+        return data;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    template <typename M>
+    inline std::span<M> SoAVector<T>::column(std::string_view member)
+    {
+        return column<M>(handleOf(member));
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    template <typename M>
+    inline std::span<M> SoAVector<T>::column(MemberHandle member)
+    {
+        const std::size_t index = checkedColumn<M>(member);
+        return {static_cast<M *>(const_cast<void *>(columnData(index))), size()};
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    template <typename M>
+    inline std::span<const M> SoAVector<T>::column(MemberHandle member) const
+    {
+        const std::size_t index = checkedColumn<M>(member);
+        return {static_cast<const M *>(columnData(index)), size()};
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline Arg SoAVector<T>::getMemberValue(std::size_t index, MemberHandle member) const
+    {
+        const std::size_t column = storedColumn(member);
+        Arg value;
+        detail::forEachIndex<column_count>([&](auto i)
+                                           {
+            if (i == column)
+                value = std::get<i>(columns)[index]; });
+        return value;
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::setMemberValue(std::size_t index, MemberHandle member, const Arg &value)
+    {
+        const std::size_t column = storedColumn(member);
+        detail::forEachIndex<column_count>([&](auto i)
+                                           {
+            using Member = typename std::tuple_element_t<i, Columns>::value_type;
+            if (i == column)
+                std::get<i>(columns)[index] = std::any_cast<Member>(value); });
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline Arg SoAVector<T>::Row::getMemberValue(std::string_view member) const
+    {
+        return owner->getMemberValue(index, handleOf(member));
+    }
+
+    template <typename T>
+        requires StaticallyDescribed<T>
+    inline void SoAVector<T>::Row::setMemberValue(std::string_view member, const Arg &value)
+    {
+        owner->setMemberValue(index, handleOf(member), value);
+    }
+
+}
@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <bit>
+
+namespace introspection
+{
+
+    inline std::uint64_t CallStats::percentileNanoseconds(double fraction) const
+    {
+        if (calls == 0)
+        {
+            return 0;
+        }
+        const auto target = static_cast<std::uint64_t>(std::clamp(fraction, 0.0, 1.0) * double(calls));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i + 1 < buckets; ++i)
+        {
+            seen += histogram[i];
+            if (seen >= std::max<std::uint64_t>(target, 1))
+            {
+                return std::min(std::uint64_t{2} << i, max_ns);
+            }
+        }
+        return max_ns;
+    }
+
+    inline CallStats &CallStats::operator+=(const CallStats &other)
+    {
+        calls += other.calls;
+        total_ns += other.total_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+        for (std::size_t i = 0; i < buckets; ++i)
+        {
+            histogram[i] += other.histogram[i];
+        }
+        return *this;
+    }
+
+    inline JsonWriter &CallStats::writeJSON(JsonWriter &out) const
+    {
+        out.beginObject()
+            .key("calls")
+            .value(calls)
+            .key("total_ns")
+            .value(total_ns)
+            .key("mean_ns")
+            .value(meanNanoseconds())
+            .key("p50_ns")
+            .value(percentileNanoseconds(0.5))
+            .key("p99_ns")
+            .value(percentileNanoseconds(0.99))
+            .key("max_ns")
+            .value(max_ns);
+
+        // Up to the last non-empty bucket
+        std::size_t used = buckets;
+        while (used > 0 && histogram[used - 1] == 0)
+        {
+            --used;
+        }
+        out.key("histogram").beginArray();
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            out.value(histogram[i]);
+        }
+        return out.endArray().endObject();
+    }
+
+    inline JsonWriter &TypeStats::writeJSON(JsonWriter &out) const
+    {
+        out.beginObject().key("class").value(class_name).key("members").beginArray();
+        for (const auto &member : members)
+        {
+            out.beginObject().key("name").value(member.name).key("get");
+            member.get.writeJSON(out).key("set");
+            member.set.writeJSON(out).endObject();
+        }
+        out.endArray().key("methods").beginArray();
+        for (const auto &method : methods)
+        {
+            out.beginObject().key("name").value(method.name).key("calls");
+            method.calls.writeJSON(out).endObject();
+        }
+        return out.endArray().endObject();
+    }
+
+    inline std::string TypeStats::toJSON() const
+    {
+        std::string buffer;
+        JsonWriter out(buffer, JsonWriter::Style::Pretty);
+        writeJSON(out);
+        return buffer;
+    }
+
+    inline void resetStats()
+    {
+        detail::StatsRegistry::instance().reset();
+    }
+
+    namespace detail
+    {
+        inline void StatsCounter::record(std::uint64_t ns)
+        {
+            const std::size_t bucket = std::min<std::size_t>(ns ? std::bit_width(ns) - 1 : 0, CallStats::buckets - 1);
+            calls.fetch_add(1, std::memory_order_relaxed);
+            total_ns.fetch_add(ns, std::memory_order_relaxed);
+            histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+            if (ns > max_ns.load(std::memory_order_relaxed))
+            {
+                max_ns.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        inline void StatsCounter::addTo(CallStats &stats) const
+        {
+            stats.calls += calls.load(std::memory_order_relaxed);
+            stats.total_ns += total_ns.load(std::memory_order_relaxed);
+            stats.max_ns = std::max(stats.max_ns, max_ns.load(std::memory_order_relaxed));
+            for (std::size_t i = 0; i < CallStats::buckets; ++i)
+            {
+                stats.histogram[i] += histogram[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        inline void StatsCounter::clear()
+        {
+            calls.store(0, std::memory_order_relaxed);
+            total_ns.store(0, std::memory_order_relaxed);
+            max_ns.store(0, std::memory_order_relaxed);
+            for (auto &bucket : histogram)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        inline StatsShard::StatsShard()
+        {
+            StatsRegistry::instance().attach(this);
+        }
+
+        inline StatsShard::~StatsShard()
+        {
+            StatsRegistry::instance().detach(this);
+        }
+
+        inline StatsRegistry &StatsRegistry::instance()
+        {
+            static StatsRegistry registry;
+            return registry;
+        }
+
+        inline void StatsRegistry::attach(StatsShard *shard)
+        {
+            std::lock_guard lock(mutex);
+            shards.push_back(shard);
+        }
+
+        inline void StatsRegistry::detach(StatsShard *shard)
+        {
+            std::lock_guard lock(mutex);
+            std::erase(shards, shard);
+            std::lock_guard shard_lock(shard->mutex);
+            if (retired.size() < shard->counters.size())
+            {
+                retired.resize(shard->counters.size());
+            }
+            for (std::size_t slot = 0; slot < shard->counters.size(); ++slot)
+            {
+                shard->counters[slot].addTo(retired[slot]);
+            }
+        }
+
+        inline void StatsRegistry::collect(std::span<const std::uint32_t> slots, std::span<CallStats> out)
+        {
+            std::lock_guard lock(mutex);
+            for (std::size_t i = 0; i < slots.size(); ++i)
+            {
+                out[i] = slots[i] < retired.size() ? retired[slots[i]] : CallStats{};
+            }
+            for (auto *shard : shards)
+            {
+                std::lock_guard shard_lock(shard->mutex);
+                for (std::size_t i = 0; i < slots.size(); ++i)
+                {
+                    if (slots[i] < shard->counters.size())
+                    {
+                        shard->counters[slots[i]].addTo(out[i]);
+                    }
+                }
+            }
+        }
+
+        inline void StatsRegistry::reset()
+        {
+            std::lock_guard lock(mutex);
+            retired.clear();
+            for (auto *shard : shards)
+            {
+                std::lock_guard shard_lock(shard->mutex);
+                for (auto &counter : shard->counters)
+                {
+                    counter.clear();
+                }
+            }
+        }
+
+        inline std::uint32_t reserveStatsSlots(std::uint32_t count)
+        {
+            static std::atomic<std::uint32_t> next{0};
+            return next.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        inline void recordCall(std::uint32_t slot, std::uint64_t ns)
+        {
+            if (slot >= no_stats_slot)
+            {
+                return;
+            }
+            thread_local StatsShard shard;
+            if (slot >= shard.counters.size())
+            {
+                std::lock_guard lock(shard.mutex);
+                while (shard.counters.size() <= slot)
+                {
+                    shard.counters.emplace_back();
+                }
+            }
+            shard.counters[slot].record(ns);
+        }
+
+        inline StatsTimer::~StatsTimer()
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            recordCall(slot, static_cast<std::uint64_t>(
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+namespace introspection
+{
+
+    inline ThreadPool::ThreadPool()
+        : ThreadPool(std::max(std::thread::hardware_concurrency(), 1u) - 1)
+    {
+    }
+
+    inline ThreadPool::ThreadPool(std::size_t threads)
+    {
+        workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+        {
+            workers.emplace_back([this]
+                                 { run(); });
+        }
+    }
+
+    inline ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    inline void ThreadPool::submit(std::function<void()> task)
+    {
+        if (workers.empty())
+        {
+            task();
+            return;
+        }
+        {
+            std::lock_guard lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        wake.notify_one();
+    }
+
+    inline void ThreadPool::run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                wake.wait(lock, [this]
+                          { return stopping || !tasks.empty(); });
+                if (tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    template <typename F>
+    inline void ThreadPool::parallelFor(std::size_t count, std::size_t min_chunk, F &&body)
+    {
+        min_chunk = std::max<std::size_t>(min_chunk, 1);
+        const std::size_t chunks = std::min(workers.size() + 1, (count + min_chunk - 1) / min_chunk);
+        if (chunks <= 1)
+        {
+            if (count > 0)
+            {
+                body(std::size_t{0}, count);
+            }
+            return;
+        }
+
+        // Chunks are claimed from a shared counter, so a slow thread does
+        // not hold back the others. `pending` counts the submitted tasks
+        // (not the chunks): `shared` must outlive the last of them.
+        struct Shared
+        {
+            std::atomic<std::size_t> next{0};
+            std::size_t pending = 0;
+            std::mutex mutex;
+            std::condition_variable done;
+            std::exception_ptr error;
+        } shared;
+        shared.pending = chunks - 1;
+
+        const std::size_t chunk_size = (count + chunks - 1) / chunks;
+        auto work = [&]
+        {
+            for (std::size_t chunk; (chunk = shared.next.fetch_add(1)) < chunks;)
+            {
+                const std::size_t begin = chunk * chunk_size;
+                const std::size_t end = std::min(count, begin + chunk_size);
+                try
+                {
+                    if (begin < end)
+                    {
+                        body(begin, end);
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(shared.mutex);
+                    if (!shared.error)
+                    {
+                        shared.error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        for (std::size_t i = 1; i < chunks; ++i)
+        {
+            submit([&]
+                   {
+                work();
+                std::lock_guard lock(shared.mutex);
+                if (--shared.pending == 0)
+                    shared.done.notify_all(); });
+        }
+        work();
+
+        std::unique_lock lock(shared.mutex);
+        shared.done.wait(lock, [&]
+                         { return shared.pending == 0; });
+        if (shared.error)
+        {
+            std::rethrow_exception(shared.error);
+        }
+    }
+
+}
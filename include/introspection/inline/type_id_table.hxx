@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <bit>
+
+namespace introspection
+{
+
+    template <typename Value>
+    inline void TypeIdTable<Value>::build(const std::vector<std::pair<TypeId, Value>> &entries)
+    {
+        const std::size_t slot_count = std::bit_ceil(std::max<std::size_t>(2, entries.size() * 2));
+        keys.assign(slot_count, 0);
+        values.assign(slot_count, Value{});
+        mask = slot_count - 1;
+        count = 0;
+
+        for (const auto &[id, value] : entries)
+        {
+            std::size_t slot = id & mask;
+            while (keys[slot] != 0 && keys[slot] != id)
+            {
+                slot = (slot + 1) & mask;
+            }
+            count += keys[slot] == 0;
+            keys[slot] = id;
+            values[slot] = value;
+        }
+    }
+
+    template <typename Value>
+    inline const Value *TypeIdTable<Value>::find(TypeId id) const
+    {
+        if (keys.empty() || id == 0)
+        {
+            return nullptr;
+        }
+        for (std::size_t slot = id & mask;; slot = (slot + 1) & mask)
+        {
+            if (keys[slot] == id)
+            {
+                return &values[slot];
+            }
+            if (keys[slot] == 0)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+}
@@ -1,8 +1,18 @@
+#include <concepts>
+#include <cstdint>
+#include <new>
 #include <stdexcept>
+#include <string>
 
 namespace introspection
 {
 
+    inline void freezeRegistries()
+    {
+        TypeNameRegistry::instance().freeze();
+        ValueCodecRegistry::instance().freeze();
+    }
+
     /**
      * @brief Get type name with support for user-registered types
      *
@@ -17,9 +27,9 @@ namespace introspection
         using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
 
         // First, check if type is registered in the user registry
-        if (TypeNameRegistry::instance().is_registered<BaseType>())
+        if (auto name = TypeNameRegistry::instance().get_name<BaseType>(); !name.empty())
         {
-            return TypeNameRegistry::instance().get_name<BaseType>();
+            return name;
         }
 
         // Built-in string types
@@ -47,9 +57,9 @@ namespace introspection
         else if constexpr (std::is_pointer_v<BaseType>)
         {
             using PointedType = std::remove_pointer_t<BaseType>;
-            if (TypeNameRegistry::instance().is_registered<PointedType>())
+            if (auto name = TypeNameRegistry::instance().get_name<PointedType>(); !name.empty())
             {
-                return TypeNameRegistry::instance().get_name<PointedType>() + "*";
+                return name + "*";
             }
             return getTypeName<PointedType>() + "*";
         }
@@ -58,9 +68,9 @@ namespace introspection
         {
             // This is likely a container
             using ValueType = typename BaseType::value_type;
-            if (TypeNameRegistry::instance().is_registered<ValueType>())
+            if (auto name = TypeNameRegistry::instance().get_name<ValueType>(); !name.empty())
             {
-                return "vector<" + TypeNameRegistry::instance().get_name<ValueType>() + ">";
+                return "vector<" + name + ">";
             }
             // Fall through to default handling
         }
@@ -118,23 +128,88 @@ namespace introspection
 
     // Rest of the file remains the same...
 
+    namespace detail
+    {
+        // Classes deriving from ChangeTracked (see change_tracked.h)
+        template <typename Class>
+        concept ChangeTrackedClass = requires(Class &object) {
+            { object.trackedChanges() } -> std::same_as<ChangeSet &>;
+        };
+
+        // Stateless accessors for a data member; the member pointer lives in the thunk context
+        template <typename Class, typename MemberType>
+        struct MemberThunks
+        {
+            using Pointer = MemberType Class::*;
+
+            // The setter also needs the member index to mark it changed
+            struct Slot
+            {
+                Pointer pointer;
+                std::uint32_t index;
+            };
+
+            static Arg get(const ThunkContext &ctx, const void *obj)
+            {
+                const auto *typed_obj = static_cast<const Class *>(obj);
+                return std::any{typed_obj->*ctx.as<Slot>().pointer};
+            }
+
+            static void set(const ThunkContext &ctx, void *obj, const Arg &value)
+            {
+                auto *typed_obj = static_cast<Class *>(obj);
+                const auto slot = ctx.as<Slot>();
+                typed_obj->*slot.pointer = std::any_cast<MemberType>(value);
+                if constexpr (ChangeTrackedClass<Class>)
+                {
+                    typed_obj->trackedChanges().mark(MemberHandle{slot.index});
+                }
+            }
+
+            static void *address(const ThunkContext &ctx, void *obj)
+            {
+                auto *typed_obj = static_cast<Class *>(obj);
+                return &(typed_obj->*ctx.as<Slot>().pointer);
+            }
+        };
+    }
+
     template <typename Class>
     template <typename MemberType>
     inline TypeRegistrar<Class> &TypeRegistrar<Class>::member(const std::string &name, MemberType Class::*member_ptr)
     {
-        info.addMember(std::make_unique<MemberInfo>(
+        using Thunks = detail::MemberThunks<Class, MemberType>;
+        // The slot addMember() will use: a re-registered name keeps its own
+        const MemberHandle existing = info.findMember(name);
+        const auto index = existing ? existing.index : static_cast<std::uint32_t>(info.members.size());
+        if constexpr (detail::ChangeTrackedClass<Class>)
+        {
+            if (index >= ChangeSet::capacity)
+            {
+                throw std::runtime_error("Class '" + info.class_name + "' has more than " +
+                                         std::to_string(ChangeSet::capacity) + " members to track");
+            }
+        }
+        const auto ctx = ThunkContext::from(typename Thunks::Slot{member_ptr, index});
+        info.addMember(MemberInfo(
             name,
             getTypeName<MemberType>(),
-            [member_ptr](const void *obj) -> std::any
-            {
-                const auto *typed_obj = static_cast<const Class *>(obj);
-                return std::any{typed_obj->*member_ptr};
-            },
-            [member_ptr](void *obj, const std::any &value)
-            {
-                auto *typed_obj = static_cast<Class *>(obj);
-                typed_obj->*member_ptr = std::any_cast<MemberType>(value);
-            }));
+            typeId<MemberType>(),
+            std::type_index(typeid(MemberType)),
+            MemberGetter(&Thunks::get, ctx),
+            MemberSetter(&Thunks::set, ctx),
+            MemberAddress(&Thunks::address, ctx),
+            ValueOps::of<MemberType>()));
+        return *this;
+    }
+
+    template <typename Class>
+    template <typename... MemberTypes>
+    inline TypeRegistrar<Class> &TypeRegistrar<Class>::fields(const std::tuple<Field<Class, MemberTypes>...> &descriptor)
+    {
+        std::apply([this](const auto &...field)
+                   { (member(std::string(field.name), field.pointer), ...); },
+                   descriptor);
         return *this;
     }
 
@@ -152,6 +227,13 @@ namespace introspection
         }
     }
 
+    // Helper function to create parameter type id vector from parameter pack
+    template <typename... Args>
+    std::vector<TypeId> createParameterTypeIdVector()
+    {
+        return std::vector<TypeId>{typeId<Args>()...};
+    }
+
     // Helper function to cast arguments from std::any vector to the correct types
     template <typename Class, typename ReturnType, typename... Args, std::size_t... I>
     inline std::any callMethodImpl(Class *obj, ReturnType (Class::*method_ptr)(Args...),
@@ -184,31 +266,135 @@ namespace introspection
         }
     }
 
+    namespace detail
+    {
+        inline void checkArgumentCount(std::size_t expected, std::size_t got)
+        {
+            if (expected != got)
+            {
+                throw std::runtime_error("Incorrect number of arguments. Expected " + std::to_string(expected) +
+                                         ", got " + std::to_string(got));
+            }
+        }
+
+        [[noreturn]] inline void throwArgumentTypeMismatch(std::size_t index)
+        {
+            throw std::runtime_error("Type mismatch for argument " + std::to_string(index));
+        }
+
+        // What frameArg() hands to a parameter: rvalue references bind to a
+        // temporary, copied or moved from the caller's value
+        template <typename Param>
+        using FrameArg = std::conditional_t<std::is_rvalue_reference_v<Param>, std::remove_cvref_t<Param>, Param>;
+
+        // Bind one frame argument to a parameter, by reference whenever
+        // possible, honouring the ArgView access (see ArgView)
+        template <typename Param>
+        inline FrameArg<Param> frameArg(const ArgView &view, std::size_t index)
+        {
+            using Base = std::remove_cvref_t<Param>;
+            constexpr bool binds_const = std::is_lvalue_reference_v<Param> &&
+                                         std::is_const_v<std::remove_reference_t<Param>>;
+            if (view.type != typeId<Base>() ||
+                (view.access == ArgView::Access::Read && std::is_reference_v<Param> && !binds_const))
+            {
+                throwArgumentTypeMismatch(index);
+            }
+            if constexpr (std::is_lvalue_reference_v<Param>)
+            {
+                // Read views only reach const references
+                return *const_cast<Base *>(static_cast<const Base *>(view.data));
+            }
+            else
+            {
+                if (view.access == ArgView::Access::Move)
+                {
+                    if constexpr (std::is_move_constructible_v<Base>)
+                    {
+                        return Base(std::move(*const_cast<Base *>(static_cast<const Base *>(view.data))));
+                    }
+                }
+                else if constexpr (std::is_copy_constructible_v<Base>)
+                {
+                    return Base(*static_cast<const Base *>(view.data));
+                }
+                throwArgumentTypeMismatch(index);
+            }
+        }
+
+        template <typename ReturnType, typename Class, typename Method, typename... Args, std::size_t... I>
+        inline void callFrameImpl(Class *obj, Method method_ptr, ArgFrame args, ReturnSlot result,
+                                  std::index_sequence<I...>)
+        {
+            if constexpr (std::is_void_v<ReturnType>)
+            {
+                (obj->*method_ptr)(frameArg<Args>(args[I], I)...);
+            }
+            else
+            {
+                using Result = std::remove_cvref_t<ReturnType>;
+                if (result.data == nullptr)
+                {
+                    (obj->*method_ptr)(frameArg<Args>(args[I], I)...);
+                }
+                else if (result.type != typeId<Result>())
+                {
+                    throw std::runtime_error("Type mismatch for return slot");
+                }
+                else
+                {
+                    *static_cast<Result *>(result.data) = (obj->*method_ptr)(frameArg<Args>(args[I], I)...);
+                }
+            }
+        }
+
+        // Stateless invokers; the method pointer lives in the thunk context
+        template <typename Class, typename ReturnType, typename... Args>
+        struct MethodThunks
+        {
+            using Pointer = ReturnType (Class::*)(Args...);
+            using ConstPointer = ReturnType (Class::*)(Args...) const;
+
+            static Arg invoke(const ThunkContext &ctx, void *obj, const std::vector<std::any> &args)
+            {
+                checkArgumentCount(sizeof...(Args), args.size());
+                return callMethodImpl(static_cast<Class *>(obj), ctx.as<Pointer>(), args,
+                                      std::index_sequence_for<Args...>{});
+            }
+
+            static Arg invokeConst(const ThunkContext &ctx, void *obj, const std::vector<std::any> &args)
+            {
+                checkArgumentCount(sizeof...(Args), args.size());
+                return callConstMethodImpl(static_cast<Class *>(obj), ctx.as<ConstPointer>(), args,
+                                           std::index_sequence_for<Args...>{});
+            }
+
+            template <typename Method>
+            static void invokeFrame(const ThunkContext &ctx, void *obj, ArgFrame args, ReturnSlot result)
+            {
+                checkArgumentCount(sizeof...(Args), args.size());
+                callFrameImpl<ReturnType, Class, Method, Args...>(static_cast<Class *>(obj), ctx.as<Method>(),
+                                                                  args, result,
+                                                                  std::index_sequence_for<Args...>{});
+            }
+        };
+    }
+
     // Variadic method registration for non-const methods
     template <typename Class>
     template <typename ReturnType, typename... Args>
     inline TypeRegistrar<Class> &TypeRegistrar<Class>::method(const std::string &name,
                                                               ReturnType (Class::*method_ptr)(Args...))
     {
-        info.addMethod(std::make_unique<MethodInfo>(
+        using Thunks = detail::MethodThunks<Class, ReturnType, Args...>;
+        info.addMethod(MethodInfo(
             name,
             getTypeName<ReturnType>(),
             createParameterTypeVector<Args...>(),
-            [method_ptr, name](void *obj, const std::vector<std::any> &args) -> std::any
-            {
-                auto *typed_obj = static_cast<Class *>(obj);
-
-                // Validate argument count at runtime
-                if (args.size() != sizeof...(Args))
-                {
-                    throw std::runtime_error("Incorrect number of arguments for method '" + name +
-                                             "'. Expected " + std::to_string(sizeof...(Args)) +
-                                             ", got " + std::to_string(args.size()));
-                }
-
-                // Use index_sequence to unpack arguments
-                return callMethodImpl(typed_obj, method_ptr, args, std::index_sequence_for<Args...>{});
-            }));
+            typeId<ReturnType>(),
+            createParameterTypeIdVector<Args...>(),
+            MethodInvoker(&Thunks::invoke, ThunkContext::from(method_ptr)),
+            FrameInvoker(&Thunks::template invokeFrame<typename Thunks::Pointer>, ThunkContext::from(method_ptr))));
         return *this;
     }
 
@@ -218,25 +404,15 @@ namespace introspection
     inline TypeRegistrar<Class> &TypeRegistrar<Class>::method(const std::string &name,
                                                               ReturnType (Class::*method_ptr)(Args...) const)
     {
-        info.addMethod(std::make_unique<MethodInfo>(
+        using Thunks = detail::MethodThunks<Class, ReturnType, Args...>;
+        info.addMethod(MethodInfo(
             name,
             getTypeName<ReturnType>(),
             createParameterTypeVector<Args...>(),
-            [method_ptr, name](void *obj, const std::vector<std::any> &args) -> std::any
-            {
-                auto *typed_obj = static_cast<Class *>(obj);
-
-                // Validate argument count at runtime
-                if (args.size() != sizeof...(Args))
-                {
-                    throw std::runtime_error("Incorrect number of arguments for method '" + name +
-                                             "'. Expected " + std::to_string(sizeof...(Args)) +
-                                             ", got " + std::to_string(args.size()));
-                }
-
-                // Use index_sequence to unpack arguments
-                return callConstMethodImpl(typed_obj, method_ptr, args, std::index_sequence_for<Args...>{});
-            }));
+            typeId<ReturnType>(),
+            createParameterTypeIdVector<Args...>(),
+            MethodInvoker(&Thunks::invokeConst, ThunkContext::from(method_ptr)),
+            FrameInvoker(&Thunks::template invokeFrame<typename Thunks::ConstPointer>, ThunkContext::from(method_ptr))));
         return *this;
     }
 
@@ -262,6 +438,37 @@ namespace introspection
         return new Class(std::any_cast<Args>(args[I])...);
     }
 
+    namespace detail
+    {
+        template <typename Class, typename... Args>
+        inline void *construct(const ThunkContext &, const std::vector<std::any> &args)
+        {
+            if (args.size() != sizeof...(Args))
+            {
+                throw std::runtime_error(
+                    "Incorrect number of constructor arguments. Expected " +
+                    std::to_string(sizeof...(Args)) +
+                    ", got " + std::to_string(args.size()));
+            }
+
+            // Use index_sequence to unpack arguments
+            return constructImpl<Class, Args...>(args, std::index_sequence_for<Args...>{});
+        }
+
+        template <typename Class, typename... Args, std::size_t... I>
+        inline void constructAtImpl(void *address, [[maybe_unused]] ArgFrame args, std::index_sequence<I...>)
+        {
+            ::new (address) Class(frameArg<Args>(args[I], I)...);
+        }
+
+        template <typename Class, typename... Args>
+        inline void constructAt(const ThunkContext &, void *address, ArgFrame args)
+        {
+            checkArgumentCount(sizeof...(Args), args.size());
+            constructAtImpl<Class, Args...>(address, args, std::index_sequence_for<Args...>{});
+        }
+    }
+
     // Constructor registration
     template <typename Class>
     template <typename... Args>
@@ -269,21 +476,9 @@ namespace introspection
     {
         info.addConstructor(std::make_unique<ConstructorInfo>(
             createConstructorParameterTypes<Args...>(),
-            [](const std::vector<std::any> &args) -> void *
-            {
-                // Validate argument count at runtime
-                if (args.size() != sizeof...(Args))
-                {
-                    throw std::runtime_error(
-                        "Incorrect number of constructor arguments. Expected " +
-                        std::to_string(sizeof...(Args)) +
-                        ", got " + std::to_string(args.size()));
-                }
-
-                // Use index_sequence to unpack arguments
-                return constructImpl<Class, Args...>(
-                    args, std::index_sequence_for<Args...>{});
-            }));
+            createParameterTypeIdVector<Args...>(),
+            ConstructorFactory(&detail::construct<Class, Args...>),
+            ConstructorEmplacer(&detail::constructAt<Class, Args...>)));
         return *this;
     }
 
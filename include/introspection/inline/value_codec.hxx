@@ -0,0 +1,568 @@
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        inline std::string_view trimJson(std::string_view json)
+        {
+            const auto is_space = [](char c)
+            { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+            while (!json.empty() && is_space(json.front()))
+                json.remove_prefix(1);
+            while (!json.empty() && is_space(json.back()))
+                json.remove_suffix(1);
+            return json;
+        }
+
+        inline void appendQuoted(std::string &out, std::string_view text)
+        {
+            static constexpr char hex[] = "0123456789abcdef";
+            out += '"';
+            std::size_t run = 0; // Start of the pending run of plain characters
+            for (std::size_t i = 0; i < text.size(); ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(text[i]);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                {
+                    continue;
+                }
+                out.append(text.data() + run, i - run);
+                run = i + 1;
+                switch (c)
+                {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                case '\b':
+                    out += "\\b";
+                    break;
+                case '\f':
+                    out += "\\f";
+                    break;
+                default:
+                    out += "\\u00";
+                    out += hex[c >> 4];
+                    out += hex[c & 0xf];
+                }
+            }
+            out.append(text.data() + run, text.size() - run);
+            out += '"';
+        }
+
+        inline void appendUtf8(std::string &out, std::uint32_t cp)
+        {
+            if (cp < 0x80)
+            {
+                out += static_cast<char>(cp);
+            }
+            else if (cp < 0x800)
+            {
+                out += static_cast<char>(0xc0 | (cp >> 6));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+            else if (cp < 0x10000)
+            {
+                out += static_cast<char>(0xe0 | (cp >> 12));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+            else
+            {
+                out += static_cast<char>(0xf0 | (cp >> 18));
+                out += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+        }
+
+        inline bool readHex4(std::string_view text, std::size_t pos, std::uint32_t &cp)
+        {
+            if (pos + 4 > text.size())
+                return false;
+            auto [ptr, ec] = std::from_chars(text.data() + pos, text.data() + pos + 4, cp, 16);
+            return ec == std::errc() && ptr == text.data() + pos + 4;
+        }
+
+        inline bool readQuoted(std::string_view json, std::string &out)
+        {
+            json = trimJson(json);
+            if (json.size() < 2 || json.front() != '"' || json.back() != '"')
+                return false;
+            json = json.substr(1, json.size() - 2);
+
+            out.clear();
+            out.reserve(json.size());
+            for (std::size_t i = 0; i < json.size(); ++i)
+            {
+                char c = json[i];
+                if (c != '\\')
+                {
+                    if (c == '"')
+                        return false;
+                    out += c;
+                    continue;
+                }
+                if (++i == json.size())
+                    return false;
+                switch (json[i])
+                {
+                case '"':
+                    out += '"';
+                    break;
+                case '\\':
+                    out += '\\';
+                    break;
+                case '/':
+                    out += '/';
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'n':
+                    out += '\n';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u':
+                {
+                    std::uint32_t cp;
+                    if (!readHex4(json, i + 1, cp))
+                        return false;
+                    i += 4;
+                    // Surrogate pair
+                    if (cp >= 0xd800 && cp < 0xdc00)
+                    {
+                        std::uint32_t low;
+                        if (i + 2 >= json.size() || json[i + 1] != '\\' || json[i + 2] != 'u' ||
+                            !readHex4(json, i + 3, low) || low < 0xdc00 || low >= 0xe000)
+                            return false;
+                        i += 6;
+                        cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                    }
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename Fn>
+        inline bool forEachJsonElement(std::string_view json, Fn &&element)
+        {
+            json = trimJson(json);
+            if (json.size() < 2 || json.front() != '[' || json.back() != ']')
+                return false;
+            json = json.substr(1, json.size() - 2);
+            if (trimJson(json).empty())
+                return true;
+
+            int depth = 0;
+            bool in_string = false;
+            std::size_t start = 0;
+            for (std::size_t i = 0; i < json.size(); ++i)
+            {
+                char c = json[i];
+                if (in_string)
+                {
+                    if (c == '\\')
+                        ++i;
+                    else if (c == '"')
+                        in_string = false;
+                    continue;
+                }
+                switch (c)
+                {
+                case '"':
+                    in_string = true;
+                    break;
+                case '[':
+                case '{':
+                    ++depth;
+                    break;
+                case ']':
+                case '}':
+                    --depth;
+                    break;
+                case ',':
+                    if (depth == 0)
+                    {
+                        if (!element(trimJson(json.substr(start, i - start))))
+                            return false;
+                        start = i + 1;
+                    }
+                    break;
+                }
+            }
+            return depth == 0 && !in_string && element(trimJson(json.substr(start)));
+        }
+
+        inline void appendRaw(std::string &out, const void *data, std::size_t size)
+        {
+            out.append(static_cast<const char *>(data), size);
+        }
+
+        inline bool readRaw(std::string_view &in, void *data, std::size_t size)
+        {
+            if (in.size() < size)
+                return false;
+            std::memcpy(data, in.data(), size);
+            in.remove_prefix(size);
+            return true;
+        }
+
+        template <typename T>
+        inline void writeBinary(std::string &out, const T &value)
+        {
+            if constexpr (HasBinaryTraits<T>)
+                ValueTraits<T>::writeBinary(out, value);
+            else
+                appendRaw(out, &value, sizeof(T));
+        }
+
+        template <typename T>
+        inline bool readBinary(std::string_view &in, T &value)
+        {
+            if constexpr (HasBinaryTraits<T>)
+                return ValueTraits<T>::readBinary(in, value);
+            else
+                return readRaw(in, &value, sizeof(T));
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    inline void ValueTraits<bool>::write(std::string &out, bool value)
+    {
+        out += value ? "true" : "false";
+    }
+
+    inline bool ValueTraits<bool>::read(std::string_view json, bool &value)
+    {
+        json = detail::trimJson(json);
+        if (json == "true")
+            value = true;
+        else if (json == "false")
+            value = false;
+        else
+            return false;
+        return true;
+    }
+
+    template <typename T>
+    inline void ValueTraits<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>::write(std::string &out, T value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // JSON has no representation for NaN and infinities
+            if (!std::isfinite(value))
+            {
+                out += "null";
+                return;
+            }
+        }
+        char buffer[32];
+        auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, ptr);
+    }
+
+    template <typename T>
+    inline bool ValueTraits<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>::read(std::string_view json, T &value)
+    {
+        json = detail::trimJson(json);
+        if (!json.empty() && json.front() == '+')
+            return false;
+        T parsed;
+        auto [ptr, ec] = std::from_chars(json.data(), json.data() + json.size(), parsed);
+        if (ec != std::errc() || ptr != json.data() + json.size())
+            return false;
+        value = parsed;
+        return true;
+    }
+
+    inline void ValueTraits<std::string>::write(std::string &out, const std::string &value)
+    {
+        detail::appendQuoted(out, value);
+    }
+
+    inline bool ValueTraits<std::string>::read(std::string_view json, std::string &value)
+    {
+        json = detail::trimJson(json);
+        if (json.size() >= 2 && json.front() == '"' && json.back() == '"')
+        {
+            // Fast path: nothing to unescape, assign in place
+            std::string_view body = json.substr(1, json.size() - 2);
+            if (body.find_first_of("\\\"") == std::string_view::npos)
+            {
+                value.assign(body);
+                return true;
+            }
+        }
+
+        std::string decoded;
+        if (!detail::readQuoted(json, decoded))
+            return false;
+        value = std::move(decoded);
+        return true;
+    }
+
+    inline void ValueTraits<std::string>::writeBinary(std::string &out, const std::string &value)
+    {
+        const auto length = static_cast<std::uint32_t>(value.size());
+        detail::appendRaw(out, &length, sizeof(length));
+        out.append(value);
+    }
+
+    inline bool ValueTraits<std::string>::readBinary(std::string_view &in, std::string &value)
+    {
+        std::uint32_t length;
+        if (!detail::readRaw(in, &length, sizeof(length)) || in.size() < length)
+            return false;
+        value.assign(in.data(), length);
+        in.remove_prefix(length);
+        return true;
+    }
+
+    template <typename T>
+    inline void ValueTraits<std::vector<T>, std::enable_if_t<HasValueTraits<T>>>::write(std::string &out, const std::vector<T> &value)
+    {
+        out += '[';
+        for (std::size_t i = 0; i < value.size(); ++i)
+        {
+            if (i > 0)
+                out += ',';
+            ValueTraits<T>::write(out, value[i]);
+        }
+        out += ']';
+    }
+
+    template <typename T>
+    inline bool ValueTraits<std::vector<T>, std::enable_if_t<HasValueTraits<T>>>::read(std::string_view json, std::vector<T> &value)
+    {
+        std::vector<T> result;
+        bool ok = detail::forEachJsonElement(json, [&result](std::string_view element)
+                                             { return ValueTraits<T>::read(element, result.emplace_back()); });
+        if (ok)
+            value = std::move(result);
+        return ok;
+    }
+
+    template <typename T>
+    inline void ValueTraits<std::vector<T>, std::enable_if_t<HasValueTraits<T>>>::writeBinary(std::string &out, const std::vector<T> &value)
+        requires detail::BinarySerializable<T>
+    {
+        const auto count = static_cast<std::uint32_t>(value.size());
+        detail::appendRaw(out, &count, sizeof(count));
+        if constexpr (detail::HasBinaryTraits<T>)
+        {
+            for (const auto &element : value)
+                ValueTraits<T>::writeBinary(out, element);
+        }
+        else
+        {
+            detail::appendRaw(out, value.data(), value.size() * sizeof(T));
+        }
+    }
+
+    template <typename T>
+    inline bool ValueTraits<std::vector<T>, std::enable_if_t<HasValueTraits<T>>>::readBinary(std::string_view &in, std::vector<T> &value)
+        requires detail::BinarySerializable<T>
+    {
+        std::uint32_t count;
+        if (!detail::readRaw(in, &count, sizeof(count)))
+            return false;
+        if constexpr (detail::HasBinaryTraits<T>)
+        {
+            // Every element takes at least one byte: reject bogus counts before allocating
+            if (count > in.size())
+                return false;
+            std::vector<T> result(count);
+            for (auto &element : result)
+            {
+                if (!ValueTraits<T>::readBinary(in, element))
+                    return false;
+            }
+            value = std::move(result);
+            return true;
+        }
+        else
+        {
+            if (in.size() / sizeof(T) < count)
+                return false;
+            value.resize(count);
+            return detail::readRaw(in, value.data(), count * sizeof(T));
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline void ValueTraits<std::array<T, N>, std::enable_if_t<HasValueTraits<T>>>::write(std::string &out, const std::array<T, N> &value)
+    {
+        out += '[';
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (i > 0)
+                out += ',';
+            ValueTraits<T>::write(out, value[i]);
+        }
+        out += ']';
+    }
+
+    template <typename T, std::size_t N>
+    inline bool ValueTraits<std::array<T, N>, std::enable_if_t<HasValueTraits<T>>>::read(std::string_view json, std::array<T, N> &value)
+    {
+        // Decoded aside, so a malformed array leaves the value untouched
+        std::array<T, N> result{};
+        std::size_t count = 0;
+        bool ok = detail::forEachJsonElement(json, [&result, &count](std::string_view element)
+                                             { return count < N && ValueTraits<T>::read(element, result[count++]); });
+        if (!ok || count != N)
+            return false;
+        value = std::move(result);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+
+    template <HasValueTraits T>
+    inline ValueCodec ValueCodec::of()
+    {
+        using Traits = ValueTraits<T>;
+
+        ValueCodec codec;
+        codec.type_id = typeId<T>();
+        codec.write = [](std::string &out, const void *value)
+        { Traits::write(out, *static_cast<const T *>(value)); };
+        codec.read = [](std::string_view json, void *value)
+        { return Traits::read(json, *static_cast<T *>(value)); };
+        codec.emplace = [](std::any &box) -> void *
+        { return &box.emplace<T>(); };
+        codec.unbox = [](const std::any &box) -> const void *
+        { return std::any_cast<T>(&box); };
+
+        if constexpr (detail::BinarySerializable<T>)
+        {
+            codec.write_binary = [](std::string &out, const void *value)
+            { detail::writeBinary(out, *static_cast<const T *>(value)); };
+            codec.read_binary = [](std::string_view &in, void *value)
+            { return detail::readBinary(in, *static_cast<T *>(value)); };
+        }
+        if constexpr (requires(const T &v) { Traits::toPython(v); })
+        {
+            codec.to_python = [](const void *value)
+            { return Traits::toPython(*static_cast<const T *>(value)); };
+        }
+        if constexpr (requires(_object *o, T &v) { Traits::fromPython(o, v); })
+        {
+            codec.from_python = [](_object *object, void *value)
+            { return Traits::fromPython(object, *static_cast<T *>(value)); };
+        }
+        if constexpr (requires(napi_env__ *env, const T &v) { Traits::toJs(env, v); })
+        {
+            codec.to_js = [](napi_env__ *env, const void *value)
+            { return Traits::toJs(env, *static_cast<const T *>(value)); };
+        }
+        if constexpr (requires(napi_env__ *env, napi_value__ *js, T &v) { Traits::fromJs(env, js, v); })
+        {
+            codec.from_js = [](napi_env__ *env, napi_value__ *js_value, void *value)
+            { return Traits::fromJs(env, js_value, *static_cast<T *>(value)); };
+        }
+        return codec;
+    }
+
+    inline ValueCodecRegistry &ValueCodecRegistry::instance()
+    {
+        static ValueCodecRegistry registry;
+        return registry;
+    }
+
+    inline ValueCodecRegistry::ValueCodecRegistry()
+    {
+        registerCodec<bool>();
+        registerCodec<int>();
+        registerCodec<unsigned int>();
+        registerCodec<long>();
+        registerCodec<unsigned long>();
+        registerCodec<long long>();
+        registerCodec<unsigned long long>();
+        registerCodec<float>();
+        registerCodec<double>();
+        registerCodec<std::string>();
+        registerCodec<std::vector<int>>();
+        registerCodec<std::vector<float>>();
+        registerCodec<std::vector<double>>();
+        registerCodec<std::vector<std::string>>();
+    }
+
+    template <HasValueTraits T>
+    inline void ValueCodecRegistry::registerCodec()
+    {
+        registerCodec(ValueCodec::of<T>());
+    }
+
+    inline void ValueCodecRegistry::registerCodec(const ValueCodec &codec)
+    {
+        std::unique_lock lock(mutex);
+        if (frozen())
+        {
+            throw std::runtime_error("Cannot register a codec: the codec registry is frozen");
+        }
+        // Never overwritten: readers hold the node without the lock
+        codecs.try_emplace(codec.type_id, codec);
+    }
+
+    inline const ValueCodec *ValueCodecRegistry::find(TypeId type_id) const
+    {
+        if (frozen())
+        {
+            const auto *codec = frozen_codecs.find(type_id);
+            return codec ? *codec : nullptr;
+        }
+        std::shared_lock lock(mutex);
+        auto it = codecs.find(type_id);
+        return it != codecs.end() ? &it->second : nullptr;
+    }
+
+    inline void ValueCodecRegistry::freeze()
+    {
+        std::unique_lock lock(mutex);
+        if (frozen())
+        {
+            return;
+        }
+        std::vector<std::pair<TypeId, const ValueCodec *>> entries;
+        entries.reserve(codecs.size());
+        for (const auto &[type_id, codec] : codecs)
+        {
+            entries.emplace_back(type_id, &codec);
+        }
+        frozen_codecs.build(entries);
+        is_frozen.store(true, std::memory_order_release);
+    }
+
+}
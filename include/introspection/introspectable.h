@@ -1,10 +1,35 @@
 #pragma once
+#include <introspection/change_set.h>
 #include <introspection/info.h>
+#include <introspection/json_reader.h>
+#include <introspection/json_writer.h>
 #include <introspection/types.h>
 
 namespace introspection
 {
 
+    /**
+     * @brief What toJSON(JsonWriter &) emits.
+     * - Full: class name, members (name, type, value) and the method schema,
+     * - ValuesOnly: a flat object mapping each member name to its value.
+     */
+    enum class JsonContent
+    {
+        Full,
+        ValuesOnly
+    };
+
+    /**
+     * @brief A problem found by fromJSON. `index` is the position of the
+     * object in a batch (0 otherwise) and `offset` the byte offset in the input.
+     */
+    struct JsonError
+    {
+        std::size_t index = 0;
+        std::size_t offset = 0;
+        std::string message;
+    };
+
     /**
      * Base class for introspectable objects.
      * Classes inheriting from Introspectable must implement the getTypeInfo()
@@ -18,10 +43,99 @@ namespace introspection
         virtual ~Introspectable() = default;
         virtual const TypeInfo &getTypeInfo() const = 0;
 
+        /**
+         * @brief Change tracking hook: the ChangeSet of a ChangeTracked
+         * object, nullptr for others. Writes through the introspection API
+         * (setters, setMember(), setMembers(), fromJSON(), batch and binary
+         * reads) mark the members they assign; markChanged() does the same
+         * for direct writes and is a no-op on untracked objects.
+         */
+        virtual ChangeSet *changeSet() { return nullptr; }
+        void markChanged(MemberHandle member);
+
         // Introspection utility methods
         std::any getMemberValue(const std::string &member_name) const;
         void setMemberValue(const std::string &member_name, const Arg &value);
         std::any callMethod(const std::string &method_name, const Args &args = {});
+
+        // Handle-based access: resolve once by name, then O(1) per call
+        MemberHandle getMemberHandle(const std::string &member_name) const;
+        MethodHandle getMethodHandle(const std::string &method_name) const;
+        std::any getMemberValue(MemberHandle member) const;
+        void setMemberValue(MemberHandle member, const Arg &value);
+        std::any callMethod(MethodHandle method, const Args &args = {});
+
+        /**
+         * @brief Allocation-free invocation through a stack-resident argument
+         * frame. Each ArgView must reference a value of exactly the parameter
+         * type (e.g. std::string for a `const std::string &` parameter) and is
+         * forwarded by reference, as its access allows (see ArgView). The
+         * result, if any, is assigned to `result`.
+         * @example
+         * ```c++
+         * std::string name = "Bob";
+         * int age = 22;
+         * std::array<ArgView, 2> frame{ArgView::of(name), ArgView::of(age)};
+         * person.invoke(person.getMethodHandle("setNameAndAge"), frame);
+         * ```
+         */
+        void invoke(MethodHandle method, ArgFrame args, ReturnSlot result = {});
+
+        /**
+         * @brief Typed convenience over invoke(): builds the frame on the stack
+         * and returns the result by value (R must be default constructible).
+         * Lvalues are passed with ArgView::of(), rvalues with ArgView::movable().
+         */
+        template <typename R = void, typename... A>
+        R call(MethodHandle method, A &&...args);
+
+        /**
+         * @brief Typed, allocation-free member access.
+         * T must be exactly the registered member type, otherwise a
+         * std::runtime_error is thrown. No std::any is involved: the reference
+         * aliases the member storage, and setMember() moves rvalues in.
+         */
+        template <typename T>
+        const T &getMemberRef(MemberHandle member) const;
+        template <typename T>
+        T &getMemberRef(MemberHandle member);
+        template <typename T>
+        void setMember(MemberHandle member, T &&value);
+
+        /**
+         * @brief Batch access to several members in one call. Every handle and
+         * value type is checked before the first write, so a failing batch
+         * (std::runtime_error) leaves the object untouched. The ArgFrame form
+         * assigns straight from the caller's values, each ArgView referencing
+         * exactly the member type; the ReturnSlot form copies members into
+         * caller storage. Neither involves std::any.
+         * @example
+         * ```c++
+         * const std::array<MemberHandle, 2> members{obj.getMemberHandle("position"),
+         *                                           obj.getMemberHandle("health")};
+         * Vector3D position(1, 2, 3);
+         * float health = 50.0f;
+         * const std::array<ArgView, 2> values{ArgView::of(position), ArgView::of(health)};
+         * obj.setMembers(members, values);
+         * ```
+         */
+        void getMembers(std::span<const MemberHandle> members, std::span<Arg> out) const;
+        void getMembers(std::span<const MemberHandle> members, std::span<const ReturnSlot> out) const;
+        void setMembers(std::span<const MemberHandle> members, std::span<const Arg> values);
+        void setMembers(std::span<const MemberHandle> members, ArgFrame values);
+
+        /**
+         * @brief Copy `members` (every member when empty) from `source`, an
+         * object of the same class, marking them changed. Trivially copyable
+         * members are copied with memcpy, others with their own copy
+         * assignment; no std::any is involved. copyFrom() assigns the whole
+         * object with the class copy assignment, or memberwise when it has
+         * none. Both throw std::runtime_error, before any write, if the
+         * classes differ or a member is not copy-assignable.
+         */
+        void copyMembersFrom(const Introspectable &source, std::span<const MemberHandle> members = {});
+        void copyFrom(const Introspectable &source);
+
         std::vector<std::string> getMemberNames() const;
         std::vector<std::string> getMethodNames() const;
         std::string getClassName() const;
@@ -31,9 +145,48 @@ namespace introspection
         void printMemberValue(const std::string &member_name) const;
         void printClassInfo() const;
 
+        /**
+         * @brief Serialize into a JsonWriter, typically wrapping a buffer
+         * reused across calls. toJSON() is the pretty-printed Full form.
+         * @example
+         * ```c++
+         * std::string buffer;
+         * for (const auto &obj : objects) {
+         *     buffer.clear();
+         *     JsonWriter json(buffer);
+         *     obj.toJSON(json, JsonContent::ValuesOnly); // {"name":"Alice","age":30}
+         *     send(buffer);
+         * }
+         * ```
+         */
+        void toJSON(JsonWriter &json, JsonContent content = JsonContent::Full) const;
         std::string toJSON() const;
+
+        /**
+         * @brief Assign members from a JSON object, either the ValuesOnly form
+         * (`{"age": 30}`) or the Full form produced by toJSON(). The input is
+         * scanned in place and each value is decoded by the member codec
+         * straight into the member. A bad field does not stop the others: all
+         * problems are returned, an empty list means success.
+         */
+        std::vector<JsonError> fromJSON(std::string_view json);
+
+        /**
+         * @brief Batch variant for a JSON array of objects. Existing elements of
+         * `objects` are updated in order, missing ones are default-constructed
+         * and extra ones are removed.
+         */
+        template <typename T>
+        static std::vector<JsonError> fromJSON(std::string_view json, std::vector<T> &objects);
     };
 
+    namespace detail
+    {
+        // The TypeInfo of an INTROSPECTABLE class: registered, finalized and timed
+        template <typename Class>
+        TypeInfo buildTypeInfo(const char *class_name, void (*register_members)(TypeRegistrar<Class>));
+    }
+
 }
 
 /**
@@ -47,30 +200,28 @@ namespace introspection
  * registerIntrospection() that must be implemented by the user to register the
  * class's members and methods. This design ensures that each introspectable
  * class has a single TypeInfo instance, avoiding redundant copies and ensuring
- * efficient memory usage. C++20 standard is used for std::any and other
- * features.
+ * efficient memory usage. The TypeInfo is built inside the initializer of a
+ * function-local static, so concurrent first calls are serialized by the
+ * compiler (a one-time guard) and later calls read it without any lock. C++20
+ * standard is used for std::any and other features.
  */
-#define INTROSPECTABLE(ClassName)                                                   \
-public:                                                                             \
-    static introspection::TypeInfo &getStaticTypeInfo()                             \
-    {                                                                               \
-        static introspection::TypeInfo info(#ClassName);                            \
-        static bool initialized = false;                                            \
-        if (!initialized)                                                           \
-        {                                                                           \
-            registerIntrospection(introspection::TypeRegistrar<ClassName>(info));   \
-            initialized = true;                                                     \
-        }                                                                           \
-        return info;                                                                \
-    }                                                                               \
-    const introspection::TypeInfo &getTypeInfo() const override                     \
-    {                                                                               \
-        return getStaticTypeInfo();                                                 \
-    }                                                                               \
-                                                                                    \
-private:                                                                            \
-    static void registerIntrospection(introspection::TypeRegistrar<ClassName> reg); \
-                                                                                    \
+#define INTROSPECTABLE(ClassName)                                                      \
+public:                                                                                \
+    static introspection::TypeInfo &getStaticTypeInfo()                                \
+    {                                                                                  \
+        static introspection::TypeInfo info =                                          \
+            introspection::detail::buildTypeInfo<ClassName>(#ClassName,                \
+                                                            &registerIntrospection);   \
+        return info;                                                                   \
+    }                                                                                  \
+    const introspection::TypeInfo &getTypeInfo() const override                        \
+    {                                                                                  \
+        return getStaticTypeInfo();                                                    \
+    }                                                                                  \
+                                                                                       \
+private:                                                                               \
+    static void registerIntrospection(introspection::TypeRegistrar<ClassName> reg);    \
+                                                                                       \
 public:
 
 #include "inline/introspectable.hxx"
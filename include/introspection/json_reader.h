@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace introspection
+{
+
+    /**
+     * @brief Pull-style JSON scanner working in place over the input text.
+     * No document tree is built: keys and values are returned as views into
+     * the input, and a value is only decoded by whoever consumes it (typically
+     * a ValueCodec reading straight into a member). Escaped keys are the only
+     * case that copies, into an internal buffer.
+     *
+     * On malformed input every call returns false/empty and `failed()`,
+     * `error()` and `offset()` describe the first problem.
+     * @example
+     * ```c++
+     * JsonReader reader(R"({"x": 1, "tags": ["a", "b"]})");
+     * std::string_view key;
+     * reader.beginObject();
+     * while (reader.nextKey(key)) {
+     *     std::string_view literal = reader.value(); // "1", then ["a", "b"]
+     * }
+     * ```
+     */
+    class JsonReader
+    {
+    public:
+        static constexpr unsigned max_depth = 64;
+
+        explicit JsonReader(std::string_view json);
+
+        // Consume '{' / '[', false if the next value is of another kind
+        bool beginObject();
+        bool beginArray();
+
+        /**
+         * @brief Advance to the next key of the current object. Returns false
+         * (having consumed the closing '}') when the object is exhausted.
+         */
+        bool nextKey(std::string_view &key);
+
+        /**
+         * @brief Advance to the next element of the current array. Returns
+         * false (having consumed the closing ']') when the array is exhausted.
+         */
+        bool nextElement();
+
+        // Consume one value and return its raw JSON text (empty on error)
+        std::string_view value();
+        bool skipValue() { return !value().empty(); }
+
+        // Type of the next value: one of { [ " t f n or a digit / '-'
+        char peek();
+        // Only whitespace is left
+        bool atEnd();
+
+        bool failed() const { return error_message != nullptr; }
+        const char *error() const { return error_message; }
+        std::size_t offset() const { return pos; }
+
+    private:
+        void skipWhitespace();
+        bool fail(const char *message);
+        bool scanString();
+        bool nextEntry(char close);
+
+        std::string_view text;
+        std::size_t pos = 0;
+        unsigned depth = 0;
+        std::uint64_t non_empty = 0; // One bit per open scope
+        const char *error_message = nullptr;
+        std::string key_buffer;
+    };
+
+}
+
+#include "inline/json_reader.hxx"
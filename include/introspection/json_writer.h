@@ -0,0 +1,69 @@
+#pragma once
+#include <introspection/value_codec.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace introspection
+{
+
+    /**
+     * @brief Streaming JSON writer appending to a caller-owned buffer.
+     * Nothing is allocated besides the growth of the buffer, so reusing the
+     * same (cleared) buffer across calls amortizes to zero allocation. Numbers
+     * are formatted with std::to_chars and strings are escaped.
+     * @example
+     * ```c++
+     * std::string buffer;
+     * JsonWriter json(buffer);
+     * json.beginObject().key("x").value(1.5).endObject(); // {"x":1.5}
+     * ```
+     */
+    class JsonWriter
+    {
+    public:
+        enum class Style
+        {
+            Compact, // No whitespace
+            Pretty   // Two spaces indentation, one entry per line
+        };
+
+        static constexpr unsigned max_depth = 64;
+
+        explicit JsonWriter(std::string &buffer, Style style = Style::Compact);
+
+        JsonWriter &beginObject();
+        JsonWriter &endObject();
+        JsonWriter &beginArray();
+        JsonWriter &endArray();
+        JsonWriter &key(std::string_view name);
+
+        JsonWriter &value(std::string_view text);
+        JsonWriter &value(const char *text);
+        JsonWriter &value(bool flag);
+        template <typename T>
+            requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        JsonWriter &value(T number);
+        // Value encoded by a codec (e.g. a member read in place)
+        JsonWriter &value(const ValueCodec &codec, const void *data);
+        JsonWriter &null();
+
+        std::string &buffer() { return out; }
+        Style style() const { return mode; }
+
+    private:
+        void beforeValue();
+        void open(char bracket);
+        void close(char bracket);
+        void newline();
+
+        std::string &out;
+        Style mode;
+        unsigned depth = 0;
+        std::uint64_t non_empty = 0; // One bit per open scope
+        bool after_key = false;
+    };
+
+}
+
+#include "inline/json_writer.hxx"
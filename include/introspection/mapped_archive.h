@@ -0,0 +1,242 @@
+#pragma once
+#include <introspection/binary.h>
+#include <introspection/introspectable.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief On-disk layout of a mapped archive. All integers are in native
+     * byte order and all offsets are from the start of the file.
+     *
+     * ```
+     * FileHeader
+     * TableHeader[table_count]     one table per class (schema table)
+     * ColumnHeader[...]            one per member, per table
+     * records                      per table: record_count * stride bytes
+     * heap                         names, string values and blobs
+     * ```
+     * Within a record, trivially copyable members are stored raw at their
+     * column offset; strings are a HeapRef to their characters; other members
+     * are a HeapRef to their codec binary encoding (a "blob"), placed so that
+     * the payload following its u32 length prefix is 8-byte aligned.
+     */
+    namespace archive
+    {
+        inline constexpr char magic[8] = {'I', 'M', 'A', 'P', '0', '0', '0', '1'};
+        inline constexpr std::uint32_t version = 1;
+
+        struct HeapRef
+        {
+            std::uint64_t offset; // From the start of the heap
+            std::uint64_t size;
+        };
+
+        enum class ColumnKind : std::uint32_t
+        {
+            Raw = 0,
+            String = 1,
+            Blob = 2
+        };
+
+        struct FileHeader
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t table_count;
+            std::uint64_t tables_offset;
+            std::uint64_t heap_offset;
+            std::uint64_t heap_size;
+            std::uint64_t file_size;
+        };
+
+        struct TableHeader
+        {
+            HeapRef class_name;
+            std::uint64_t schema_hash;
+            std::uint64_t record_count;
+            std::uint64_t records_offset;
+            std::uint64_t columns_offset;
+            std::uint32_t column_count;
+            std::uint32_t stride;
+        };
+
+        struct ColumnHeader
+        {
+            HeapRef name;
+            HeapRef type_name;
+            std::uint32_t offset; // In the record
+            std::uint32_t size;   // In the record
+            ColumnKind kind;
+            std::uint32_t reserved;
+        };
+    }
+
+    /**
+     * @brief Collects objects and writes them as a mapped archive, one table
+     * per class. Members that are neither trivially copyable nor strings must
+     * have a codec binary encoding.
+     */
+    class MappedArchiveWriter
+    {
+    public:
+        void add(const Introspectable &object);
+
+        // Throws std::runtime_error if the file cannot be written
+        void save(const std::string &path) const;
+        void serialize(std::string &out) const;
+
+    private:
+        struct Table
+        {
+            const TypeInfo *type = nullptr;
+            std::vector<archive::ColumnHeader> columns;
+            std::vector<const ValueCodec *> codecs; // Blob columns only
+            std::uint32_t stride = 0;
+            std::uint64_t record_count = 0;
+            std::string records;
+        };
+
+        archive::HeapRef addToHeap(std::string_view bytes);
+        archive::HeapRef addBlobToHeap(std::string_view blob);
+
+        std::vector<Table> tables;
+        std::string heap;
+        std::string scratch;
+    };
+
+    class MappedTable;
+
+    /**
+     * @brief Read-only view of one record of a mapped archive, with the member
+     * access API of Introspectable. Strings are returned as views into the
+     * mapping and raw members by reference, without copy. Typed access needs
+     * the table to be bound to the TypeInfo of the class (see
+     * MappedArchive::table()), and then uses the same MemberHandles.
+     */
+    class RecordView
+    {
+    public:
+        RecordView(const MappedTable &table, const std::byte *record) : table(&table), record(record) {}
+
+        std::string getClassName() const;
+        std::vector<std::string> getMemberNames() const;
+        bool hasMember(std::string_view name) const;
+        MemberHandle getMemberHandle(std::string_view name) const;
+
+        // Decoded copy of a member (needs a bound table, except for strings)
+        std::any getMemberValue(std::string_view name) const;
+        std::any getMemberValue(MemberHandle member) const;
+
+        // Zero-copy access
+        template <typename T>
+        const T &getMemberRef(MemberHandle member) const; // Raw members
+        std::string_view getString(MemberHandle member) const;
+        template <typename T>
+        std::span<const T> getSpan(MemberHandle member) const; // std::vector<T> of trivially copyable T
+
+        // Raw bytes of a member column: the value, or the HeapRef of strings and blobs
+        const std::byte *columnData(std::size_t column) const;
+
+    private:
+        const archive::ColumnHeader &column(MemberHandle member) const;
+        std::string_view heapBytes(std::size_t column) const;
+
+        const MappedTable *table;
+        const std::byte *record;
+    };
+
+    /**
+     * @brief All the records of one class in a mapped archive.
+     */
+    class MappedTable
+    {
+    public:
+        std::string_view className() const;
+        std::uint64_t schemaHash() const { return header->schema_hash; }
+        std::size_t size() const { return static_cast<std::size_t>(header->record_count); }
+        std::uint32_t stride() const { return header->stride; }
+        RecordView operator[](std::size_t index) const;
+
+        std::span<const archive::ColumnHeader> columns() const { return column_headers; }
+        std::string_view columnName(std::size_t column) const;
+        std::string_view columnTypeName(std::size_t column) const;
+        std::size_t findColumn(std::string_view name) const; // columns().size() if unknown
+
+        // The TypeInfo this table is bound to, nullptr if none
+        const TypeInfo *typeInfo() const { return type; }
+        // Bind to `type_info` if class name and schema hash match
+        bool bind(const TypeInfo &type_info);
+
+        std::string_view heap() const { return heap_bytes; }
+
+    private:
+        friend class MappedArchive;
+
+        const archive::TableHeader *header = nullptr;
+        std::span<const archive::ColumnHeader> column_headers;
+        const std::byte *records = nullptr;
+        std::string_view heap_bytes;
+        const TypeInfo *type = nullptr;
+    };
+
+    /**
+     * @brief A mapped archive file. Opening maps the file read-only and reads
+     * the schema table only, so it costs O(tables + columns) whatever the
+     * number of records; record pages are faulted in on first access. Views
+     * are valid as long as the archive is alive.
+     * @example
+     * ```c++
+     * MappedArchive archive("people.imap");
+     * const auto &people = archive.table(Person::getStaticTypeInfo());
+     * auto age = people.typeInfo()->findMember("age");
+     * for (std::size_t i = 0; i < people.size(); ++i)
+     *     total += people[i].getMemberRef<int>(age);
+     * ```
+     */
+    class MappedArchive
+    {
+    public:
+        // Throws std::runtime_error if the file cannot be mapped or is malformed
+        explicit MappedArchive(const std::string &path);
+        ~MappedArchive();
+
+        MappedArchive(const MappedArchive &) = delete;
+        MappedArchive &operator=(const MappedArchive &) = delete;
+        MappedArchive(MappedArchive &&other) noexcept;
+        MappedArchive &operator=(MappedArchive &&other) noexcept;
+
+        std::span<const MappedTable> tables() const { return table_views; }
+        const MappedTable *find(std::string_view class_name) const;
+
+        /**
+         * @brief Table of a class, bound to its TypeInfo. Throws
+         * std::runtime_error if the archive has no such table or if its schema
+         * differs.
+         */
+        const MappedTable &table(const TypeInfo &type_info);
+
+        std::size_t fileSize() const { return size; }
+
+    private:
+        void unmap();
+        void parse();
+
+        const std::byte *data = nullptr;
+        std::size_t size = 0;
+#if defined(_WIN32)
+        void *file_handle = nullptr;
+        void *mapping_handle = nullptr;
+#endif
+        std::vector<MappedTable> table_views;
+    };
+
+}
+
+#include "inline/mapped_archive.hxx"
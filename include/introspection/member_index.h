@@ -0,0 +1,146 @@
+#pragma once
+#include <introspection/introspectable.h>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Content hash and equality of objects over their registered
+     * members (every member when `members` is empty), computed through the
+     * member ValueOps straight from the object storage: no std::any. Objects of
+     * different classes are never equal. Throw std::runtime_error if a member
+     * has no std::hash or no operator==.
+     */
+    std::size_t hashMembers(const Introspectable &object, std::span<const MemberHandle> members = {});
+    bool equalMembers(const Introspectable &a, const Introspectable &b, std::span<const MemberHandle> members = {});
+
+    /**
+     * @brief hashMembers() / equalMembers() as functors, to deduplicate
+     * objects by content in unordered containers of pointers.
+     * @example
+     * ```c++
+     * std::unordered_set<const Introspectable *, MemberHash, MemberEqual> unique;
+     * for (const auto &object : objects)
+     *     unique.insert(&object);
+     * ```
+     */
+    struct MemberHash
+    {
+        std::vector<MemberHandle> members; // Empty: every member
+
+        std::size_t operator()(const Introspectable *object) const { return hashMembers(*object, members); }
+    };
+
+    struct MemberEqual
+    {
+        std::vector<MemberHandle> members; // Empty: every member
+
+        bool operator()(const Introspectable *a, const Introspectable *b) const
+        {
+            return equalMembers(*a, *b, members);
+        }
+    };
+
+    enum class IndexOrder
+    {
+        Hashed, // O(1) lookups
+        Sorted  // O(log n) lookups and range queries
+    };
+
+    /**
+     * @brief Secondary index of objects of class T by the value of one member
+     * of type K (exactly the registered member type), so that a lookup by
+     * value does not scan the collection.
+     *
+     * Tracked objects (ChangeTracked) are followed through a ChangeSet
+     * listener: a write marking the key member queues the object, and the
+     * next query re-keys the queued objects first, reading the key from the
+     * object. Writes must therefore not run while a query does. Only the
+     * notification is thread-safe: erase() and the destructor wait for the
+     * writers still notifying the index. Queries, insert() and erase() are
+     * not thread-safe either. Untracked objects, or tracked ones written
+     * without marking, are re-keyed with update(). Objects must be erased
+     * before they are destroyed.
+     * @example
+     * ```c++
+     * MemberIndex<GameObject, std::string> by_name("name");
+     * by_name.insert(std::span<GameObject>(objects));
+     *
+     * objects[3].setMemberValue("name", std::string("boss"));
+     * GameObject *boss = by_name.find("boss");            // O(1)
+     *
+     * MemberIndex<GameObject, int, IndexOrder::Sorted> by_level("level");
+     * by_level.insert(std::span<GameObject>(objects));
+     * auto veterans = by_level.range(10, 20);             // level in [10, 20)
+     * ```
+     */
+    template <typename T, typename K, IndexOrder Order = IndexOrder::Hashed>
+    class MemberIndex
+    {
+    public:
+        // Throw std::runtime_error if the member is unknown or not a K
+        explicit MemberIndex(MemberHandle member);
+        explicit MemberIndex(std::string_view member);
+        MemberIndex(const MemberIndex &) = delete;
+        MemberIndex &operator=(const MemberIndex &) = delete;
+        ~MemberIndex(); // Stops listening to the indexed objects
+
+        // Insert an object (or re-key it if already indexed)
+        void insert(T &object);
+        void insert(std::span<T> objects);
+        void erase(T &object);
+
+        // Re-key an object after writes the index could not see
+        void update(T &object);
+        // Re-key the objects queued by their change sets; queries call it
+        void refresh();
+
+        T *find(const K &key);
+        std::vector<T *> findAll(const K &key);
+        std::size_t count(const K &key);
+        std::vector<T *> range(const K &low, const K &high) // [low, high)
+            requires(Order == IndexOrder::Sorted);
+
+        std::size_t size() const { return entries.size(); }
+        MemberHandle member() const { return key_member; }
+
+    private:
+        struct Entry : ChangeObserver
+        {
+            MemberIndex *index = nullptr;
+            T *object = nullptr;
+            ChangeSet *changes = nullptr;
+            K key{};
+            std::atomic<bool> queued{false};
+
+            void memberChanged(MemberHandle member) override;
+        };
+
+        using Keys = std::conditional_t<Order == IndexOrder::Hashed, std::unordered_multimap<K, Entry *>,
+                                        std::multimap<K, Entry *>>;
+
+        const K &currentKey(const T &object) const;
+        void rekey(Entry &entry);
+        void unlink(Entry &entry);
+        void enqueue(Entry *entry);
+
+        MemberHandle key_member;
+        Keys keys;
+        std::unordered_map<const T *, std::unique_ptr<Entry>> entries;
+        std::mutex queue_mutex;
+        std::vector<Entry *> queue;
+    };
+
+}
+
+#include "inline/member_index.hxx"
@@ -0,0 +1,58 @@
+#pragma once
+#include <introspection/binary.h>
+#include <introspection/introspectable.h>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Member-level diff between two objects of the same class: the
+     * handles of the members whose values differ, in registration order.
+     * Values are compared with operator== when the type has one, otherwise by
+     * their bytes (trivially copyable types) or their codec encoding. Throws
+     * std::runtime_error if the objects are of different classes.
+     */
+    std::vector<MemberHandle> diff(const Introspectable &from, const Introspectable &to);
+
+    /**
+     * @brief Compact binary patch carrying new values of some members.
+     *
+     * Layout (native byte order): the 4 bytes "IPT1", the schema hash of the
+     * class (u64, see TypeInfo::schemaHash()), a u32 entry count, then per
+     * entry the u32 member index followed by the value, encoded as in the
+     * binary archive (see BinaryWriter).
+     *
+     * The members to send come from diff() or from a ChangeTracked object.
+     * writeJsonPatch() emits the same content as a JSON merge patch
+     * (`{"health": 75}`), which Introspectable::fromJSON() applies.
+     * @example
+     * ```c++
+     * std::string patch;
+     * writePatch(patch, last_sent, player);    // Only the members that changed
+     * send(patch);
+     * ...
+     * applyPatch(replica, received);
+     * ```
+     */
+    void writePatch(std::string &out, const Introspectable &object, std::span<const MemberHandle> members);
+    std::size_t writePatch(std::string &out, const Introspectable &from, const Introspectable &to);
+
+    /**
+     * @brief Assign the members carried by a patch, returning their count.
+     * The whole patch is decoded before the first assignment, so a truncated
+     * patch, or one made for another schema, throws std::runtime_error and
+     * leaves the object untouched.
+     */
+    std::size_t applyPatch(Introspectable &object, std::string_view patch);
+
+    void writeJsonPatch(JsonWriter &json, const Introspectable &object, std::span<const MemberHandle> members);
+    std::size_t writeJsonPatch(JsonWriter &json, const Introspectable &from, const Introspectable &to);
+
+}
+
+#include "inline/patch.hxx"
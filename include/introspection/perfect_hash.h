@@ -0,0 +1,48 @@
+#pragma once
+#include <introspection/type_id.h>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Collision-free name -> index table, rebuilt whenever the key set
+     * changes (hash-and-displace scheme). Keys are hashed once into a bucket;
+     * each bucket stores a displacement chosen at build time so that all its
+     * keys land in distinct slots. A lookup is therefore one pass of FNV-1a over
+     * the key, a few integer operations and a single string comparison, with
+     * no probing.
+     *
+     * The index does not store the keys: `find` is given a callback returning
+     * the key of a candidate index, so the names stay owned by their tables.
+     */
+    class PerfectHashIndex
+    {
+    public:
+        static constexpr std::uint32_t npos = 0xffffffffu;
+
+        /**
+         * @brief Build the table for `keys`, which must be distinct. The index
+         * of a key is its position in `keys`.
+         */
+        void build(const std::vector<std::string_view> &keys);
+
+        template <typename KeyAt>
+        std::uint32_t find(std::string_view key, KeyAt &&key_at) const;
+
+        std::size_t memoryBytes() const;
+
+    private:
+        static std::uint64_t mix(std::uint64_t hash, std::uint32_t displacement);
+
+        std::vector<std::uint32_t> displacements; // One per bucket
+        std::vector<std::uint32_t> slots;         // Key index, or npos
+        std::uint64_t bucket_mask = 0;
+        std::uint64_t slot_mask = 0;
+    };
+
+}
+
+#include "inline/perfect_hash.hxx"
@@ -0,0 +1,243 @@
+#pragma once
+#include <introspection/introspectable.h>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace introspection
+{
+
+    namespace detail
+    {
+        /**
+         * @brief Contiguous storage of one SoAVector column, aligned on a cache
+         * line (a plain std::vector would pack bool columns into bits and
+         * could not be viewed as a span).
+         */
+        template <typename T>
+        class SoAColumn
+        {
+        public:
+            using value_type = T;
+            static constexpr std::size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+
+            SoAColumn() = default;
+            SoAColumn(const SoAColumn &other);
+            SoAColumn(SoAColumn &&other) noexcept;
+            SoAColumn &operator=(SoAColumn other) noexcept;
+            ~SoAColumn();
+
+            std::size_t size() const { return count; }
+            T *data() { return items; }
+            const T *data() const { return items; }
+            T &operator[](std::size_t index) { return items[index]; }
+            const T &operator[](std::size_t index) const { return items[index]; }
+
+            void reserve(std::size_t new_capacity);
+            void resize(std::size_t new_size);
+            void push_back(const T &value);
+            void pop_back();
+            void clear();
+
+        private:
+            void grow();
+
+            T *items = nullptr;
+            std::size_t count = 0;
+            std::size_t capacity = 0;
+        };
+
+        template <typename Field>
+        using SoAColumnOf = SoAColumn<typename Field::value_type>;
+
+        template <typename Fields>
+        struct SoAColumns;
+
+        template <typename... Fields>
+        struct SoAColumns<std::tuple<Fields...>>
+        {
+            using type = std::tuple<SoAColumnOf<Fields>...>;
+        };
+    }
+
+    /**
+     * @brief Structure-of-arrays container of an introspectable class with a
+     * static descriptor (see StaticallyDescribed): each member of the
+     * descriptor is stored in its own contiguous column, so a system updating
+     * one member of many objects touches only that column.
+     *
+     * Columns are exposed as spans, at compile time by index (column<I>()) or
+     * at runtime by name or MemberHandle of the class TypeInfo. Rows can be
+     * accessed in place through Row, or materialized into a real T through
+     * proxy(), which then supports the whole Introspectable API (JSON, method
+     * calls, bridges) and writes the row back when released. Members that are
+     * not in the descriptor are not stored.
+     * @example
+     * ```c++
+     * SoAVector<GameObject> objects;
+     * objects.push_back(GameObject("Npc", Vector3D(1, 2, 3)));
+     *
+     * for (float &health : objects.column<float>("health"))
+     *     health -= 1.0f;
+     *
+     * {
+     *     auto object = objects.proxy(0);   // A GameObject copy of row 0
+     *     object->callMethod("move", {Vector3D(1, 0, 0)});
+     * }                                     // Written back here
+     * ```
+     */
+    template <typename T>
+        requires StaticallyDescribed<T>
+    class SoAVector
+    {
+        using Descriptor = decltype(T::staticFields());
+        using Columns = typename detail::SoAColumns<Descriptor>::type;
+
+    public:
+        static constexpr std::size_t column_count = static_member_count<T>;
+        static_assert(column_count > 0, "The static descriptor has no field");
+        static constexpr std::size_t npos = ~std::size_t{0};
+
+        class Row;
+        class Proxy;
+
+        std::size_t size() const { return std::get<0>(columns).size(); }
+        bool empty() const { return size() == 0; }
+        /**
+         * @brief Size changes apply to every column or to none: if a column
+         * throws (e.g. copying a std::string), the columns already changed are
+         * rolled back and the container keeps its previous rows.
+         */
+        void reserve(std::size_t capacity);
+        void resize(std::size_t new_size); // New rows are default-constructed members
+        void clear();
+
+        void push_back(const T &object);
+        template <typename... Args>
+        void emplace_back(Args &&...args) { push_back(T(std::forward<Args>(args)...)); }
+        void pop_back();
+
+        // Copy of a row into a T, and the reverse. set() copies every field
+        // before assigning any, so a throwing copy leaves the row untouched
+        T get(std::size_t index) const;
+        void set(std::size_t index, const T &object);
+
+        Row operator[](std::size_t index) { return Row(*this, index); }
+        Proxy proxy(std::size_t index) { return Proxy(*this, index); }
+
+        // Column by descriptor index
+        template <std::size_t I>
+        auto column() { return std::span(std::get<I>(columns).data(), size()); }
+        template <std::size_t I>
+        auto column() const { return std::span(std::get<I>(columns).data(), size()); }
+
+        /**
+         * @brief Column of a member by name or handle. Throws
+         * std::runtime_error if the member is not stored or is not exactly a M.
+         */
+        template <typename M>
+        std::span<M> column(std::string_view member);
+        template <typename M>
+        std::span<M> column(MemberHandle member);
+        template <typename M>
+        std::span<const M> column(MemberHandle member) const;
+
+        // Descriptor index of a member of the TypeInfo of T, npos if not stored
+        static std::size_t columnOf(MemberHandle member);
+
+        Arg getMemberValue(std::size_t index, MemberHandle member) const;
+        void setMemberValue(std::size_t index, MemberHandle member, const Arg &value);
+
+        /**
+         * @brief In-place access to one row. Invalidated by any operation
+         * changing the size of the container.
+         */
+        class Row
+        {
+        public:
+            Row(SoAVector &owner, std::size_t index) : owner(&owner), index(index) {}
+
+            T load() const { return owner->get(index); }
+            void store(const T &object) { owner->set(index, object); }
+
+            template <typename M>
+            M &getMemberRef(MemberHandle member) { return owner->template column<M>(member)[index]; }
+            Arg getMemberValue(MemberHandle member) const { return owner->getMemberValue(index, member); }
+            Arg getMemberValue(std::string_view member) const;
+            void setMemberValue(MemberHandle member, const Arg &value) { owner->setMemberValue(index, member, value); }
+            void setMemberValue(std::string_view member, const Arg &value);
+
+        private:
+            SoAVector *owner;
+            std::size_t index;
+        };
+
+        /**
+         * @brief A row materialized into a T. Changes made through it are
+         * written back by commit(), which may throw, or when the proxy is
+         * destroyed. The destructor never throws: it skips the write-back
+         * while an exception unwinds the scope of the proxy, and drops the
+         * changes if the write-back throws, so call commit() to see errors.
+         */
+        class Proxy
+        {
+        public:
+            Proxy(SoAVector &owner, std::size_t index)
+                : owner(&owner), index(index), object(owner.get(index)), exceptions(std::uncaught_exceptions()) {}
+            Proxy(Proxy &&other) noexcept
+                : owner(std::exchange(other.owner, nullptr)), index(other.index), object(std::move(other.object)),
+                  exceptions(other.exceptions) {}
+            Proxy(const Proxy &) = delete;
+            Proxy &operator=(const Proxy &) = delete;
+            Proxy &operator=(Proxy &&) = delete;
+            ~Proxy()
+            {
+                if (std::uncaught_exceptions() > exceptions)
+                    return; // Half-edited state is not written back
+                try
+                {
+                    commit();
+                }
+                catch (...)
+                {
+                }
+            }
+
+            T &operator*() { return object; }
+            T *operator->() { return &object; }
+
+            void commit()
+            {
+                if (owner)
+                    owner->set(index, object);
+            }
+
+        private:
+            SoAVector *owner;
+            std::size_t index;
+            T object;
+            int exceptions; // In flight at construction
+        };
+
+    private:
+        static const TypeInfo &typeInfo() { return T::getStaticTypeInfo(); }
+        static MemberHandle handleOf(std::string_view member);
+        static std::size_t storedColumn(MemberHandle member);
+        template <typename M>
+        static std::size_t checkedColumn(MemberHandle member);
+        const void *columnData(std::size_t column) const;
+        // Roll the first `changed_columns` columns back to `old_size` rows
+        void restoreSize(std::size_t old_size, std::size_t changed_columns);
+
+        Columns columns;
+    };
+
+}
+
+#include "inline/soa.hxx"
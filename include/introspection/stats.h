@@ -0,0 +1,159 @@
+#pragma once
+#include <introspection/json_writer.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace introspection
+{
+
+#if defined(INTROSPECTION_ENABLE_STATS)
+    inline constexpr bool stats_enabled = true;
+#else
+    inline constexpr bool stats_enabled = false;
+#endif
+
+    /**
+     * @brief Call count and latency of one dispatch point (a member getter,
+     * a member setter or a method). Bucket i of the histogram counts the calls
+     * that took [2^i, 2^(i+1)) nanoseconds; the last bucket is open-ended.
+     */
+    struct CallStats
+    {
+        static constexpr std::size_t buckets = 32;
+
+        std::uint64_t calls = 0;
+        std::uint64_t total_ns = 0;
+        std::uint64_t max_ns = 0;
+        std::array<std::uint64_t, buckets> histogram{};
+
+        double meanNanoseconds() const { return calls ? double(total_ns) / double(calls) : 0.0; }
+
+        // Upper bound of the bucket holding the given fraction of the calls (0.99: p99)
+        std::uint64_t percentileNanoseconds(double fraction) const;
+
+        CallStats &operator+=(const CallStats &other);
+        JsonWriter &writeJSON(JsonWriter &out) const;
+    };
+
+    struct MemberStats
+    {
+        std::string name;
+        CallStats get; // getMemberValue() and bridge reads
+        CallStats set; // setMemberValue() and bridge writes
+    };
+
+    struct MethodStats
+    {
+        std::string name;
+        CallStats calls; // callMethod() and invoke()
+    };
+
+    /**
+     * @brief Snapshot of the counters of one class, in registration order,
+     * as returned by TypeInfo::stats().
+     */
+    struct TypeStats
+    {
+        std::string class_name;
+        std::vector<MemberStats> members;
+        std::vector<MethodStats> methods;
+
+        JsonWriter &writeJSON(JsonWriter &out) const;
+        std::string toJSON() const;
+    };
+
+    // Zero every counter, on every thread
+    void resetStats();
+
+    namespace detail
+    {
+        // Counters of a dispatch point on one thread; written by that thread only
+        struct StatsCounter
+        {
+            std::atomic<std::uint64_t> calls{0};
+            std::atomic<std::uint64_t> total_ns{0};
+            std::atomic<std::uint64_t> max_ns{0};
+            std::array<std::atomic<std::uint64_t>, CallStats::buckets> histogram{};
+
+            void record(std::uint64_t ns);
+            void addTo(CallStats &stats) const;
+            void clear();
+        };
+
+        // The counters of one thread, indexed by stats slot. The owning
+        // thread grows the table under the mutex; readers take it too
+        struct StatsShard
+        {
+            std::mutex mutex;
+            std::deque<StatsCounter> counters;
+
+            StatsShard();
+            ~StatsShard(); // Folds the counters into the registry
+        };
+
+        /**
+         * @brief Every live shard, plus the totals of the threads that have
+         * exited. Aggregation only happens on demand (TypeInfo::stats()).
+         */
+        class StatsRegistry
+        {
+        public:
+            static StatsRegistry &instance();
+
+            void attach(StatsShard *shard);
+            void detach(StatsShard *shard);
+            void collect(std::span<const std::uint32_t> slots, std::span<CallStats> out);
+            void reset();
+
+        private:
+            std::mutex mutex;
+            std::vector<StatsShard *> shards;
+            std::vector<CallStats> retired; // By slot
+        };
+
+        // Each member takes two consecutive slots (get, set), each method one
+        std::uint32_t reserveStatsSlots(std::uint32_t count);
+
+        // Slot of a dispatch point that is not counted, until
+        // TypeInfo::assignStatsSlots(). The set slot of a member (+1) is past it too
+        inline constexpr std::uint32_t no_stats_slot = std::numeric_limits<std::uint32_t>::max() - 1;
+        void recordCall(std::uint32_t slot, std::uint64_t ns);
+
+        class StatsTimer
+        {
+        public:
+            explicit StatsTimer(std::uint32_t slot) : slot(slot), start(std::chrono::steady_clock::now()) {}
+            StatsTimer(const StatsTimer &) = delete;
+            StatsTimer &operator=(const StatsTimer &) = delete;
+            ~StatsTimer();
+
+        private:
+            std::uint32_t slot;
+            std::chrono::steady_clock::time_point start;
+        };
+    }
+
+}
+
+/**
+ * Time the rest of the enclosing scope against a stats slot. Expands to
+ * nothing, without evaluating `slot`, unless INTROSPECTION_ENABLE_STATS is
+ * defined (CMake option of the same name).
+ */
+#if defined(INTROSPECTION_ENABLE_STATS)
+#define INTROSPECTION_STATS_SCOPE(slot) \
+    const ::introspection::detail::StatsTimer introspection_stats_timer_(slot)
+#else
+#define INTROSPECTION_STATS_SCOPE(slot) static_cast<void>(0)
+#endif
+
+#include "inline/stats.hxx"
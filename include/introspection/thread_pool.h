@@ -0,0 +1,61 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Fixed set of worker threads running queued tasks, used to
+     * partition batch operations over many objects (see batch.h).
+     * parallelFor() splits an index range into chunks, runs them on the
+     * workers and on the calling thread, and returns once all are done,
+     * rethrowing the first exception thrown by a chunk. A pool of 0 threads
+     * runs everything on the caller.
+     * @example
+     * ```c++
+     * ThreadPool pool;                      // hardware_concurrency() - 1 workers
+     * pool.parallelFor(objects.size(), 4096, [&](std::size_t begin, std::size_t end) {
+     *     for (std::size_t i = begin; i < end; ++i)
+     *         objects[i].update();
+     * });
+     * ```
+     */
+    class ThreadPool
+    {
+    public:
+        ThreadPool();
+        explicit ThreadPool(std::size_t threads);
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+        ~ThreadPool(); // Finishes the queued tasks, then joins
+
+        std::size_t size() const { return workers.size(); }
+
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief Call body(begin, end) over [0, count) in chunks of at least
+         * `min_chunk` indices. Must not be called from a task of this pool.
+         */
+        template <typename F>
+        void parallelFor(std::size_t count, std::size_t min_chunk, F &&body);
+
+    private:
+        void run();
+
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+    };
+
+}
+
+#include "inline/thread_pool.hxx"
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace introspection
+{
+
+    /**
+     * @brief Small inline storage for the state of a Thunk, typically the bytes
+     * of a member or method pointer. It is large enough to hold any
+     * pointer-to-member on the supported ABIs, so no heap allocation is ever
+     * needed.
+     */
+    class ThunkContext
+    {
+    public:
+        static constexpr std::size_t capacity = 3 * sizeof(void *);
+
+        ThunkContext() = default;
+
+        template <typename T>
+        static ThunkContext from(const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Thunk context must be trivially copyable");
+            static_assert(sizeof(T) <= capacity, "Thunk context is too large");
+            ThunkContext ctx;
+            std::memcpy(ctx.bytes, &value, sizeof(T));
+            return ctx;
+        }
+
+        template <typename T>
+        T as() const
+        {
+            T value;
+            std::memcpy(&value, bytes, sizeof(T));
+            return value;
+        }
+
+    private:
+        alignas(void *) unsigned char bytes[capacity] = {};
+    };
+
+    template <typename Signature>
+    class Thunk;
+
+    /**
+     * @brief Type-erased callable made of a plain function pointer and an inline
+     * ThunkContext. Registration instantiates one stateless function per
+     * member/method type, so calling a Thunk is a single indirect call with no
+     * allocation, unlike std::function.
+     */
+    template <typename R, typename... A>
+    class Thunk<R(A...)>
+    {
+    public:
+        using Function = R (*)(const ThunkContext &, A...);
+
+        Thunk() = default;
+        Thunk(Function fn, const ThunkContext &ctx = {}) : function(fn), context(ctx) {}
+
+        R operator()(A... args) const
+        {
+            return function(context, std::forward<A>(args)...);
+        }
+
+        explicit operator bool() const { return function != nullptr; }
+
+    private:
+        Function function = nullptr;
+        ThunkContext context;
+    };
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace introspection
+{
+
+    /**
+     * @brief Compact type identifier computed at compile time.
+     * It is an FNV-1a hash of the compiler's signature for the (cv/ref
+     * stripped) type, so it can be used as a `case` label and compared with a
+     * single integer comparison. Ids are stable for a given compiler but are not
+     * meant to be persisted across toolchains.
+     *
+     * @example
+     * ```c++
+     * switch (member.type_id)
+     * {
+     * case typeId<int>():
+     *     ...
+     * case typeId<std::string>():
+     *     ...
+     * }
+     * ```
+     */
+    using TypeId = std::uint64_t;
+
+    namespace detail
+    {
+        constexpr std::uint64_t fnv1a(std::string_view text, std::uint64_t hash = 14695981039346656037ull)
+        {
+            for (char c : text)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        template <typename T>
+        constexpr std::string_view typeSignature()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // A constant, so the hash is never computed at run time: outside of
+        // constant expressions, compilers do not reliably fold the loop
+        template <typename T>
+        inline constexpr TypeId type_id_value = fnv1a(typeSignature<T>());
+    }
+
+    template <typename T>
+    constexpr TypeId typeId()
+    {
+        return detail::type_id_value<std::remove_cv_t<std::remove_reference_t<T>>>;
+    }
+
+}
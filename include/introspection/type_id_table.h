@@ -0,0 +1,37 @@
+#pragma once
+#include <introspection/type_id.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace introspection
+{
+
+    /**
+     * @brief Immutable TypeId -> value table with open addressing. TypeIds are
+     * already well mixed hashes, so a slot is found from the low bits of the id
+     * and linear probing, at a load factor of at most one half. Built once (see
+     * the registries freeze()), then safe to read from any number of threads
+     * without synchronization. The id 0 is reserved as the empty slot marker.
+     */
+    template <typename Value>
+    class TypeIdTable
+    {
+    public:
+        void build(const std::vector<std::pair<TypeId, Value>> &entries);
+
+        // nullptr if `id` is not in the table
+        const Value *find(TypeId id) const;
+
+        std::size_t size() const { return count; }
+
+    private:
+        std::vector<TypeId> keys;
+        std::vector<Value> values;
+        std::size_t mask = 0;
+        std::size_t count = 0;
+    };
+
+}
+
+#include "inline/type_id_table.hxx"
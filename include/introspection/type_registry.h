@@ -1,8 +1,15 @@
 #pragma once
+#include <introspection/type_id.h>
+#include <introspection/type_id_table.h>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <typeindex>
 #include <functional>
+#include <vector>
 
 namespace introspection
 {
@@ -37,12 +44,18 @@ namespace introspection
          * @brief Register a type with a custom name
          * @tparam T The type to register
          * @param name The human-readable name for the type
+         * @throws std::runtime_error if the registry is frozen
          */
         template <typename T>
         void register_type(const std::string &name)
         {
             using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
-            type_names[std::type_index(typeid(BaseType))] = name;
+            std::unique_lock lock(mutex);
+            if (frozen())
+            {
+                throw std::runtime_error("Cannot register type '" + name + "': the type registry is frozen");
+            }
+            type_names[typeId<BaseType>()] = name;
         }
 
         /**
@@ -54,7 +67,13 @@ namespace introspection
         std::string get_name() const
         {
             using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
-            auto it = type_names.find(std::type_index(typeid(BaseType)));
+            if (frozen())
+            {
+                const auto *name = frozen_names.find(typeId<BaseType>());
+                return name ? **name : std::string();
+            }
+            std::shared_lock lock(mutex);
+            auto it = type_names.find(typeId<BaseType>());
             return (it != type_names.end()) ? it->second : "";
         }
 
@@ -65,7 +84,12 @@ namespace introspection
         bool is_registered() const
         {
             using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
-            return type_names.find(std::type_index(typeid(BaseType))) != type_names.end();
+            if (frozen())
+            {
+                return frozen_names.find(typeId<BaseType>()) != nullptr;
+            }
+            std::shared_lock lock(mutex);
+            return type_names.find(typeId<BaseType>()) != type_names.end();
         }
 
         /**
@@ -73,17 +97,45 @@ namespace introspection
          */
         std::vector<std::string> get_all_registered_types() const
         {
+            std::shared_lock lock(mutex);
             std::vector<std::string> names;
-            for (const auto &[idx, name] : type_names)
+            for (const auto &[id, name] : type_names)
             {
                 names.push_back(name);
             }
             return names;
         }
 
+        /**
+         * @brief Make the registry immutable. Lookups then read a flat table
+         * without taking any lock, and register_type() throws. Call it once
+         * start-up registration is over.
+         */
+        void freeze()
+        {
+            std::unique_lock lock(mutex);
+            if (frozen())
+            {
+                return;
+            }
+            std::vector<std::pair<TypeId, const std::string *>> entries;
+            entries.reserve(type_names.size());
+            for (const auto &[id, name] : type_names)
+            {
+                entries.emplace_back(id, &name);
+            }
+            frozen_names.build(entries);
+            is_frozen.store(true, std::memory_order_release);
+        }
+
+        bool frozen() const { return is_frozen.load(std::memory_order_acquire); }
+
     private:
         TypeNameRegistry() = default;
-        std::unordered_map<std::type_index, std::string> type_names;
+        std::unordered_map<TypeId, std::string> type_names; // Nodes are stable: the frozen table points into them
+        mutable std::shared_mutex mutex;
+        std::atomic<bool> is_frozen{false};
+        TypeIdTable<const std::string *> frozen_names;
     };
 
     // ----------------------------------------------------------------
@@ -149,14 +201,12 @@ namespace introspection
 public:                                                                                       \
     static introspection::TypeInfo &getStaticTypeInfo()                                       \
     {                                                                                         \
-        static introspection::TypeInfo info(#ClassName);                                      \
-        static bool initialized = false;                                                      \
-        if (!initialized)                                                                     \
+        static introspection::TypeInfo info = []                                              \
         {                                                                                     \
             introspection::TypeNameRegistry::instance().register_type<ClassName>(#ClassName); \
-            registerIntrospection(introspection::TypeRegistrar<ClassName>(info));             \
-            initialized = true;                                                               \
-        }                                                                                     \
+            return introspection::detail::buildTypeInfo<ClassName>(#ClassName,                \
+                                                                   &registerIntrospection);   \
+        }();                                                                                  \
         return info;                                                                          \
     }                                                                                         \
     const introspection::TypeInfo &getTypeInfo() const override                               \
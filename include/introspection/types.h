@@ -1,4 +1,6 @@
 #pragma once
+#include <introspection/change_set.h>
+#include <introspection/descriptor.h>
 #include <introspection/info.h>
 #include <introspection/type_registry.h>
 
@@ -16,6 +18,13 @@ namespace introspection
     template <typename T>
     std::string getTypeName();
 
+    /**
+     * @brief Freeze the type name and codec registries once start-up
+     * registration is over (see TypeNameRegistry::freeze()). Lookups from any
+     * number of threads are then lock-free; later registrations throw.
+     */
+    void freezeRegistries();
+
     /**
      * @brief Helper class to register members and methods of a class.
      * This class is used in conjunction with the INTROSPECTABLE macro to
@@ -31,7 +40,10 @@ namespace introspection
         TypeInfo &info;
 
     public:
-        explicit TypeRegistrar(TypeInfo &type_info) : info(type_info) {}
+        explicit TypeRegistrar(TypeInfo &type_info) : info(type_info)
+        {
+            info.object = ObjectOps::of<Class>();
+        }
 
         /**
          * @brief Register a member variable.
@@ -45,6 +57,13 @@ namespace introspection
         TypeRegistrar &member(const std::string &name,
                               MemberType Class::*member_ptr);
 
+        /**
+         * @brief Register every member of a static descriptor (see
+         * StaticallyDescribed), in order, as if by member().
+         */
+        template <typename... MemberTypes>
+        TypeRegistrar &fields(const std::tuple<Field<Class, MemberTypes>...> &descriptor);
+
         /**
          * @brief Register a method based on C++ variadic method registration
          * (handles any number of parameters). This method registers a method of the
@@ -0,0 +1,226 @@
+#pragma once
+#include <introspection/type_id.h>
+#include <introspection/type_id_table.h>
+#include <any>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Opaque handles of the scripting runtimes (PyObject, napi_env, napi_value), so
+// that codecs can provide native conversions without this header depending on
+// Python or Node headers
+struct _object;
+struct napi_env__;
+struct napi_value__;
+
+namespace introspection
+{
+
+    /**
+     * @brief Per-type conversion rules. Specialize it for your own types to
+     * make them serializable by toJSON, the WebSocket GUI and the scripting
+     * bridges:
+     * ```c++
+     * template <>
+     * struct introspection::ValueTraits<Vector3D>
+     * {
+     *     static void write(std::string &out, const Vector3D &v);   // append a JSON literal
+     *     static bool read(std::string_view json, Vector3D &v);     // parse a JSON literal
+     *
+     *     // Optional binary encoding (BinaryWriter / BinaryReader), a raw copy
+     *     // is used for trivially copyable types when absent
+     *     static void writeBinary(std::string &out, const Vector3D &v);
+     *     static bool readBinary(std::string_view &in, Vector3D &v); // consumes its bytes
+     *
+     *     // Optional native conversions, JSON is used when absent
+     *     static _object *toPython(const Vector3D &v);              // new reference
+     *     static bool fromPython(_object *o, Vector3D &v);
+     *     static napi_value__ *toJs(napi_env__ *env, const Vector3D &v);
+     *     static bool fromJs(napi_env__ *env, napi_value__ *js, Vector3D &v);
+     * };
+     * REGISTER_CODEC(Vector3D);
+     * ```
+     * Built-in specializations are provided for bool, the arithmetic types,
+     * std::string, std::vector<T> and std::array<T, N>.
+     */
+    template <typename T, typename = void>
+    struct ValueTraits
+    {
+    };
+
+    template <typename T>
+    concept HasValueTraits = requires(std::string &out, const T &value, std::string_view json, T &target) {
+        ValueTraits<T>::write(out, value);
+        { ValueTraits<T>::read(json, target) } -> std::same_as<bool>;
+    };
+
+    /**
+     * @brief Type-erased conversion table of one type, built from its
+     * ValueTraits. All functions work on a pointer to the value, so a member can
+     * be serialized straight from the object storage.
+     */
+    struct ValueCodec
+    {
+        TypeId type_id = 0;
+
+        // Append the value as a JSON literal
+        void (*write)(std::string &out, const void *value) = nullptr;
+        // Parse a JSON literal into the value, false if malformed
+        bool (*read)(std::string_view json, void *value) = nullptr;
+
+        // Default-construct a value inside a std::any and return its address
+        void *(*emplace)(std::any &box) = nullptr;
+        // Address of the value held by a std::any, nullptr on type mismatch
+        const void *(*unbox)(const std::any &box) = nullptr;
+
+        // Append / consume the binary encoding (see BinaryWriter)
+        void (*write_binary)(std::string &out, const void *value) = nullptr;
+        bool (*read_binary)(std::string_view &in, void *value) = nullptr;
+
+        // Optional native bridge conversions
+        _object *(*to_python)(const void *value) = nullptr;
+        bool (*from_python)(_object *object, void *value) = nullptr;
+        napi_value__ *(*to_js)(napi_env__ *env, const void *value) = nullptr;
+        bool (*from_js)(napi_env__ *env, napi_value__ *js_value, void *value) = nullptr;
+
+        template <HasValueTraits T>
+        static ValueCodec of();
+    };
+
+    /**
+     * @brief Registry of the value codecs, keyed by TypeId. Built-in types are
+     * registered on construction; other types register once through
+     * REGISTER_CODEC (or registerCodec<T>()) and are then available to every
+     * serializer and bridge. The first codec of a type stays: members and
+     * bridges hold pointers to it without locking, so registering the type
+     * again (from another translation unit, or for a built-in) is ignored.
+     *
+     * The registry is thread-safe. Once every codec is registered, freeze()
+     * turns it into an immutable table: lookups then take no lock at all and
+     * further registrations throw std::runtime_error.
+     */
+    class ValueCodecRegistry
+    {
+    public:
+        static ValueCodecRegistry &instance();
+
+        template <HasValueTraits T>
+        void registerCodec();
+        void registerCodec(const ValueCodec &codec);
+
+        // nullptr when no codec is registered for the type
+        const ValueCodec *find(TypeId type_id) const;
+
+        void freeze();
+        bool frozen() const { return is_frozen.load(std::memory_order_acquire); }
+
+    private:
+        ValueCodecRegistry();
+        std::unordered_map<TypeId, ValueCodec> codecs; // Nodes are stable: the frozen table points into them
+        mutable std::shared_mutex mutex;
+        std::atomic<bool> is_frozen{false};
+        TypeIdTable<const ValueCodec *> frozen_codecs;
+    };
+
+    namespace detail
+    {
+        // Append `text` as a quoted and escaped JSON string
+        void appendQuoted(std::string &out, std::string_view text);
+        // Parse a quoted JSON string, resolving escape sequences
+        bool readQuoted(std::string_view json, std::string &out);
+        std::string_view trimJson(std::string_view json);
+        // Call `element(std::string_view)` for each top-level element of a JSON array
+        template <typename Fn>
+        bool forEachJsonElement(std::string_view json, Fn &&element);
+
+        // Raw binary helpers (native byte order), `readRaw` consumes `size` bytes of `in`
+        void appendRaw(std::string &out, const void *data, std::size_t size);
+        bool readRaw(std::string_view &in, void *data, std::size_t size);
+
+        // Binary encoding of T: ValueTraits<T>::writeBinary/readBinary, or a raw copy
+        template <typename T>
+        void writeBinary(std::string &out, const T &value);
+        template <typename T>
+        bool readBinary(std::string_view &in, T &value);
+
+        template <typename T>
+        concept HasBinaryTraits = requires(std::string &out, const T &value, std::string_view &in, T &target) {
+            ValueTraits<T>::writeBinary(out, value);
+            { ValueTraits<T>::readBinary(in, target) } -> std::same_as<bool>;
+        };
+
+        template <typename T>
+        concept BinarySerializable = HasBinaryTraits<T> || std::is_trivially_copyable_v<T>;
+    }
+
+    // ------------------------------------------------------------------------
+
+    template <>
+    struct ValueTraits<bool>
+    {
+        static void write(std::string &out, bool value);
+        static bool read(std::string_view json, bool &value);
+    };
+
+    template <typename T>
+    struct ValueTraits<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static void write(std::string &out, T value);
+        static bool read(std::string_view json, T &value);
+    };
+
+    template <>
+    struct ValueTraits<std::string>
+    {
+        static void write(std::string &out, const std::string &value);
+        static bool read(std::string_view json, std::string &value);
+        static void writeBinary(std::string &out, const std::string &value);
+        static bool readBinary(std::string_view &in, std::string &value);
+    };
+
+    template <typename T>
+    struct ValueTraits<std::vector<T>, std::enable_if_t<HasValueTraits<T>>>
+    {
+        static void write(std::string &out, const std::vector<T> &value);
+        static bool read(std::string_view json, std::vector<T> &value);
+        static void writeBinary(std::string &out, const std::vector<T> &value)
+            requires detail::BinarySerializable<T>;
+        static bool readBinary(std::string_view &in, std::vector<T> &value)
+            requires detail::BinarySerializable<T>;
+    };
+
+    template <typename T, std::size_t N>
+    struct ValueTraits<std::array<T, N>, std::enable_if_t<HasValueTraits<T>>>
+    {
+        static void write(std::string &out, const std::array<T, N> &value);
+        static bool read(std::string_view json, std::array<T, N> &value);
+    };
+
+}
+
+/**
+ * @brief Register the codec of a type having a ValueTraits specialization
+ *
+ * Usage: REGISTER_CODEC(Vector3D);
+ * This should be called at global scope.
+ */
+#define REGISTER_CODEC(TypeName)                                                             \
+    namespace                                                                                \
+    {                                                                                        \
+        struct TypeName##_CodecRegistrar                                                     \
+        {                                                                                    \
+            TypeName##_CodecRegistrar()                                                      \
+            {                                                                                \
+                introspection::ValueCodecRegistry::instance().registerCodec<TypeName>();     \
+            }                                                                                \
+        };                                                                                   \
+        static TypeName##_CodecRegistrar TypeName##_codec_registrar_instance;                \
+    }
+
+#include "inline/value_codec.hxx"
@@ -0,0 +1,194 @@
+#include <introspection/mapped_archive.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using introspection::MappedArchive;
+using introspection::MappedTable;
+using introspection::RecordView;
+namespace archive = introspection::archive;
+
+// Inspects mapped archives without the registered classes: only the schema
+// tables stored in the file are used.
+
+static void usage()
+{
+    std::cerr << "Usage: archive_tool info <file>\n"
+              << "       archive_tool dump <file> [--limit N]\n"
+              << "       archive_tool verify <file>\n";
+}
+
+static const char *kindName(archive::ColumnKind kind)
+{
+    switch (kind)
+    {
+    case archive::ColumnKind::Raw:
+        return "raw";
+    case archive::ColumnKind::String:
+        return "string";
+    case archive::ColumnKind::Blob:
+        return "blob";
+    }
+    return "?";
+}
+
+template <typename T>
+static T load(const std::byte *data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+static bool printPrimitive(std::string_view type_name, std::size_t size, const std::byte *data)
+{
+    if (type_name == "int" && size == sizeof(int))
+        std::cout << load<int>(data);
+    else if (type_name == "float" && size == sizeof(float))
+        std::cout << load<float>(data);
+    else if (type_name == "double" && size == sizeof(double))
+        std::cout << load<double>(data);
+    else if (type_name == "bool" && size == sizeof(bool))
+        std::cout << (load<bool>(data) ? "true" : "false");
+    else if (type_name == "long" && size == sizeof(long))
+        std::cout << load<long>(data);
+    else
+        return false;
+    return true;
+}
+
+static void printValue(const MappedTable &table, const RecordView &record, std::size_t column)
+{
+    const auto &header = table.columns()[column];
+    const std::byte *data = record.columnData(column);
+    switch (header.kind)
+    {
+    case archive::ColumnKind::Raw:
+        if (!printPrimitive(table.columnTypeName(column), header.size, data))
+            std::cout << "<" << header.size << " bytes>";
+        break;
+    case archive::ColumnKind::String:
+        std::cout << '"' << record.getString(introspection::MemberHandle{static_cast<std::uint32_t>(column)}) << '"';
+        break;
+    case archive::ColumnKind::Blob:
+        std::cout << "<" << load<archive::HeapRef>(data).size << " byte blob>";
+        break;
+    }
+}
+
+static int info(const MappedArchive &file)
+{
+    std::cout << "File size: " << file.fileSize() << " bytes, " << file.tables().size() << " table(s)\n";
+    for (const auto &table : file.tables())
+    {
+        std::cout << "\n"
+                  << table.className() << ": " << table.size() << " records, stride "
+                  << table.stride() << ", " << table.columns().size() << " columns, schema " << std::hex
+                  << table.schemaHash() << std::dec << "\n";
+        for (std::size_t i = 0; i < table.columns().size(); ++i)
+        {
+            const auto &column = table.columns()[i];
+            std::cout << "  " << table.columnName(i) << " (" << table.columnTypeName(i) << ", "
+                      << kindName(column.kind) << ", offset " << column.offset << ", size " << column.size << ")\n";
+        }
+    }
+    return 0;
+}
+
+static int dump(const MappedArchive &file, std::size_t limit)
+{
+    for (const auto &table : file.tables())
+    {
+        std::cout << table.className() << " (" << table.size() << " records)\n";
+        const std::size_t count = std::min(limit, table.size());
+        for (std::size_t r = 0; r < count; ++r)
+        {
+            const RecordView record = table[r];
+            std::cout << "  [" << r << "]";
+            for (std::size_t c = 0; c < table.columns().size(); ++c)
+            {
+                std::cout << (c == 0 ? " " : ", ") << table.columnName(c) << "=";
+                printValue(table, record, c);
+            }
+            std::cout << "\n";
+        }
+        if (count < table.size())
+            std::cout << "  ... " << table.size() - count << " more\n";
+    }
+    return 0;
+}
+
+// Opening only checks the schema tables; check every string and blob of every record
+static int verify(const MappedArchive &file)
+{
+    std::size_t errors = 0;
+    for (const auto &table : file.tables())
+    {
+        const std::size_t heap_size = table.heap().size();
+        for (std::size_t r = 0; r < table.size(); ++r)
+        {
+            const RecordView record = table[r];
+            for (std::size_t c = 0; c < table.columns().size(); ++c)
+            {
+                if (table.columns()[c].kind == archive::ColumnKind::Raw)
+                    continue;
+                const auto ref = load<archive::HeapRef>(record.columnData(c));
+                if (ref.offset > heap_size || ref.size > heap_size - ref.offset)
+                {
+                    std::cout << table.className() << "[" << r << "]." << table.columnName(c)
+                              << ": reference out of the heap\n";
+                    ++errors;
+                }
+            }
+        }
+    }
+    std::cout << (errors == 0 ? "OK" : std::to_string(errors) + " error(s)") << "\n";
+    return errors == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        usage();
+        return 2;
+    }
+    const std::string command = argv[1];
+    std::size_t limit = 10;
+    if (argc == 5 && std::string(argv[3]) == "--limit")
+    {
+        const std::string_view text = argv[4];
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), limit);
+        if (error != std::errc() || end != text.data() + text.size())
+        {
+            std::cerr << "Invalid --limit '" << text << "'\n";
+            usage();
+            return 2;
+        }
+    }
+    else if (argc != 3)
+    {
+        usage();
+        return 2;
+    }
+
+    try
+    {
+        const MappedArchive file(argv[2]);
+        if (command == "info")
+            return info(file);
+        if (command == "dump")
+            return dump(file, limit);
+        if (command == "verify")
+            return verify(file);
+        usage();
+        return 2;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}